@@ -0,0 +1,820 @@
+/*
+**     mktables - builds the case and accent tables of unifuzz (build tool)
+**
+**     Copyright (C) 2017,2025  Daniel Moore
+**
+**     This program is free software: you can redistribute it and/or modify
+**     it under the terms of the GNU General Public License as published by
+**     the Free Software Foundation, either version 3 of the License, or
+**     (at your option) any later version.
+**
+**     This program is distributed in the hope that it will be useful,
+**     but WITHOUT ANY WARRANTY; without even the implied warranty of
+**     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**     GNU General Public License for more details.
+**
+**     You should have received a copy of the GNU General Public License
+**     along with this program.  If not, see [http://www.gnu.org/licenses/].
+**
+**
+** fold(), lower(), upper(), title(), proper(), unaccent(), LIKE and TYPOS
+** of unifuzz.c read all the properties of a code point, U+0000 to U+10FFFF,
+** with a single walk of one three-stage table:
+**
+**      props_spans[c >> (shift + span shift)]
+**                                  the span of c in props_indexes[]; past
+**                                  U+10FFFF, the last one, of code points
+**                                  without properties
+**      props_indexes[]             1 << span shift entries per span: the block
+**                                  of record numbers in props_blocks[], and
+**                                  the base of the expansions of that block
+**                                  in unacc_data[]
+**      props_blocks[]              record numbers, 1 << shift per block
+**      props_records[]             the fold, lower, upper and title mappings
+**                                  as signed deltas modulo 0x10000, within
+**                                  the plane of the code point (0 leaves it
+**                                  unchanged), then the offset of the
+**                                  unaccented expansion from the base and
+**                                  its length (0 for none), and those of
+**                                  the expansion of the folded code point,
+**                                  fold then unaccent for LIKE and TYPOS
+**
+** Identical spans, blocks and records are stored once.  As expansions are
+** addressed from the base of their block, records differing only by the
+** code points they expand to are shared too.  Folded expansions are those
+** of the folded code points, wherever they are: their offsets are modulo
+** 0x10000.
+**
+** Expansions are stored as 16 bit code units.  The few code points above
+** the BMP they hold are escaped: code unit UNACC_ESCAPE + i, a surrogate,
+** stands for unacc_astral[i], padded to a power of 2.
+**
+** PROPS_FINGERPRINT is the 64-bit FNV-1a of the mappings of every code
+** point, whatever the layout: unifuzz_tables() reports it, and the
+** extension computes it again from a table file before using it.
+**
+**      mktables [-s shift] [-t shift] [-i bits] [-o file] table file ... > unifuzz_tables.h
+**
+** writes the table from the mappings of each table named (fold, lower,
+** upper, title and unacc), read from its file:
+**
+**      -s shift    log2 of the block size, 2 to 12 (3 by default)
+**      -t shift    log2 of the span size, in index entries, 1 to 10 (6 by
+**                  default), the two shifts adding up to 16 at most
+**      -i bits     record numbers of 8, 16 or 32 bits, 0 (the default) for
+**                  the narrowest that holds the records
+**      -o file     writes the table to <file> instead, in the binary format
+**                  that unifuzz maps at load time in place of its compiled
+**                  table (see PropsFileHeaderT in unifuzz.c); the shifts and
+**                  the widths of its numbers must be those of the compiled
+**                  table
+**
+** Files are read line by line, comments from '#', fields split at ';':
+**
+**      UnicodeData.txt     the simple uppercase, lowercase and titlecase
+**                          mappings (fields 12 to 14), for upper, lower and
+**                          title
+**      CaseFolding.txt     the C and S mappings, for fold
+**      otherwise           <code point>; <code point> ...: the format of
+**                          the files of tools/tables, the Unicode 5.1
+**                          mappings unifuzz has always shipped
+**
+** Case mappings must stay within the plane of the code point, as they all
+** do in Unicode.
+**
+**      mktables -b sample [-s shift] [-t shift] [-i bits] table file ...
+**
+** benchmarks the table at every block shift from 3 to 10 instead: its size
+** in bytes, and the nanoseconds per lookup of all the properties of the
+** code points of <sample> (UTF-8 text, names say) and of random code points
+** of the BMP.  The chosen shift is flagged with '*'.  Keep a layout that
+** stays in the L1 / L2 caches of the target, and set it in the Makefile.
+**
+** Build with the host compiler:
+**
+**      cc -O2 tools/mktables.c -o mktables
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define CODE_POINTS     0x110000
+#define BMP_SIZE        0x10000
+#define PLANE(c)        ((c) & ~0xFFFFu)
+#define MAX_MAPPING     32
+#define MIN_SHIFT       2
+#define MAX_SHIFT       12
+#define MIN_SPAN_SHIFT  1
+#define MAX_SPAN_SHIFT  10
+#define MAX_SHIFTS      16                  /* block shift plus span shift */
+#define TRIE_POINTS     (CODE_POINTS + (1 << MAX_SHIFTS))
+#define MAX_POOL        (1 << 20)
+#define BENCH_LOOKUPS   20000000
+#define BENCH_RUNS      7
+#define HASH_SIZE       (1 << 17)
+#define UNACC_ESCAPE    0xD800              /* surrogates, never expanded to */
+#define MAX_ASTRAL      0x800
+#define FNV_BASIS       0xCBF29CE484222325ULL
+#define FNV_PRIME       0x00000100000001B3ULL
+#define FILE_MAGIC      "UFZPROPS"
+#define FILE_VERSION    1
+#define FILE_ARRAYS     6
+
+#define CASE_COUNT      4                   /* fold, lower, upper and title */
+#define TABLE_UNACC     CASE_COUNT
+#define TABLE_COUNT     (CASE_COUNT + 1)
+
+static const char *azTable[TABLE_COUNT] = { "fold", "lower", "upper", "title", "unacc" };
+
+/* the properties of each code point, none past U+10FFFF */
+static unsigned short aDelta[CASE_COUNT][TRIE_POINTS];     /* modulo 0x10000 */
+static unsigned char aUnaccLen[TRIE_POINTS];                /* 0 if none */
+static unsigned int aUnaccAt[TRIE_POINTS];                  /* in aPool[] */
+static unsigned int aPool[MAX_POOL];                        /* code units */
+static int nPool;
+static unsigned int aAstral[MAX_ASTRAL];                    /* escaped code points */
+static int nAstral;
+
+/* as CodePropsIndexT and CodePropsT of unifuzz_tables.h */
+typedef struct index_ {
+    unsigned short block;
+    unsigned short unacc;
+} index_t;
+
+typedef struct record_ {
+    unsigned short aDelta[CASE_COUNT];
+    unsigned short unacc;
+    unsigned short foldUnacc;
+    unsigned char unaccLen;
+    unsigned char foldUnaccLen;
+} record_t;
+
+/* as PropsFileHeaderT of unifuzz.c */
+typedef struct file_header_ {
+    char zMagic[8];
+    unsigned long long checksum;
+    unsigned long long fingerprint;
+    unsigned int version;
+    unsigned int byteOrder;
+    unsigned int size;
+    unsigned char blockShift;
+    unsigned char spanShift;
+    unsigned char spanBits;
+    unsigned char idBits;
+    unsigned int spansSize;
+    unsigned int spanCount;
+    unsigned int blockCount;
+    unsigned int recordCount;
+    unsigned int dataSize;
+    unsigned int astralCount;
+    unsigned int astralMask;
+    unsigned int aOffset[FILE_ARRAYS];
+    unsigned int reserved;
+} file_header_t;
+
+typedef struct trie_ {
+    int shift;
+    int spanShift;
+    int idBits;
+    int spanBits;
+    int nPoint;                             /* code points, up to a span past U+10FFFF */
+    int nSpan;
+    int nSpanBlock;
+    int nBlock;
+    int nRecord;
+    int nData;
+    unsigned int *aSpan;                    /* nSpan span numbers */
+    index_t *aIndex;                        /* nSpanBlock spans of index entries */
+    unsigned int *aId;                      /* nBlock blocks of record numbers */
+    record_t *aRecord;
+    unsigned int *aData;                    /* code units of the expansions, 0 first */
+    int aHash[HASH_SIZE];                   /* of the records, -1 if free */
+} trie_t;
+
+static void fail(const char *zFormat, const char *zArg)
+{
+    fprintf(stderr, "mktables: ");
+    fprintf(stderr, zFormat, zArg);
+    fprintf(stderr, "\n");
+    exit(1);
+}
+
+/*
+** Splits zLine at ';' into at most nMax trimmed fields, stopping at '#'
+*/
+static int split_fields(char *zLine, char **azField, int nMax)
+{
+    char *z, *zEnd;
+    int n = 0;
+
+    if ((z = strchr(zLine, '#')) != NULL) *z = 0;
+    if ((z = strchr(zLine, '\n')) != NULL) *z = 0;
+    for (z = zLine; (n < nMax); n++) {
+        while ((*z == ' ') || (*z == '\t')) z++;
+        azField[n] = z;
+        zEnd = strchr(z, ';');
+        if (zEnd) *zEnd = 0;
+        z += strlen(z);
+        while ((z > azField[n]) && ((z[-1] == ' ') || (z[-1] == '\t') || (z[-1] == '\r'))) *--z = 0;
+        if (!zEnd) return n + 1;
+        z = zEnd + 1;
+    }
+    return n;
+}
+
+/*
+** Reads the code points of zField, separated by spaces, into a mapping
+*/
+static int read_code_points(const char *zField, unsigned int *aCode)
+{
+    char *zEnd;
+    int n = 0;
+
+    while (*zField) {
+        if (n == MAX_MAPPING) fail("mapping too long: %s", zField);
+        aCode[n++] = (unsigned int) strtoul(zField, &zEnd, 16);
+        if (zEnd == zField) fail("not a code point: %s", zField);
+        for (zField = zEnd; *zField == ' '; zField++);
+    }
+    return n;
+}
+
+/*
+** Code unit of an expansion to c: c in the BMP, else an escape, the number
+** of c in aAstral[] from UNACC_ESCAPE
+*/
+static unsigned int code_unit(unsigned int c)
+{
+    int i;
+
+    if ((c >= UNACC_ESCAPE) && (c < UNACC_ESCAPE + MAX_ASTRAL)) fail("%s expands to a surrogate", "unacc");
+    if (c < BMP_SIZE) return c;
+    for (i = 0; (i < nAstral) && (aAstral[i] != c); i++);
+    if (i == MAX_ASTRAL) fail("%s: too many code points above the BMP", "unacc");
+    if (i == nAstral) aAstral[nAstral++] = c;
+    return UNACC_ESCAPE + i;
+}
+
+static void read_table(int iTable, const char *zFile)
+{
+    FILE *f = fopen(zFile, "r");
+    char zLine[1024], *azField[16];
+    unsigned int c, aCode[MAX_MAPPING];
+    int n, k, iField, nCode;
+
+    if (f == NULL) fail("cannot open %s", zFile);
+    while (fgets(zLine, sizeof(zLine), f)) {
+        n = split_fields(zLine, azField, 16);
+        if ((n < 2) || (azField[0][0] == 0)) continue;
+        if (n >= 15) {
+            // UnicodeData.txt
+            if (iTable == 1) iField = 13;
+            else if (iTable == 2) iField = 12;
+            else if (iTable == 3) iField = azField[14][0] ? 14 : 12;
+            else fail("UnicodeData.txt has no mapping for %s", azTable[iTable]);
+        } else if ((n >= 3) && (strlen(azField[1]) == 1)) {
+            // CaseFolding.txt: the simple folding
+            if ((azField[1][0] != 'C') && (azField[1][0] != 'S')) continue;
+            iField = 2;
+        } else {
+            iField = 1;
+        }
+        if (azField[iField][0] == 0) continue;
+        if (read_code_points(azField[0], aCode) != 1) fail("not a single code point: %s", azField[0]);
+        c = aCode[0];
+        if (c >= CODE_POINTS) continue;
+        nCode = read_code_points(azField[iField], aCode);
+        if ((nCode == 1) && (aCode[0] == c)) continue;
+        if (iTable == TABLE_UNACC) {
+            if (nPool + nCode > MAX_POOL) fail("%s: too many expansions", azTable[iTable]);
+            aUnaccAt[c] = nPool;
+            for (k = 0; k < nCode; k++) aPool[nPool++] = code_unit(aCode[k]);
+            aUnaccLen[c] = (unsigned char) nCode;
+        } else {
+            if (nCode > 1) fail("%s maps each code point to a single one", azTable[iTable]);
+            if (PLANE(aCode[0]) != PLANE(c)) fail("%s maps each code point within its plane", azTable[iTable]);
+            aDelta[iTable][c] = (unsigned short) (aCode[0] - c);
+        }
+    }
+    fclose(f);
+}
+
+static int width_of(unsigned int max)
+{
+    return (max <= 0xFF) ? 8 : (max <= 0xFFFF) ? 16 : 32;
+}
+
+/*
+** Number of the record *r, stored if new
+*/
+static unsigned int record_id(trie_t *p, const record_t *r)
+{
+    const unsigned char *z = (const unsigned char *) r;
+    unsigned int h = 2166136261u, k;
+
+    for (k = 0; k < sizeof(*r); k++) h = (h ^ z[k]) * 16777619u;
+    for (h &= HASH_SIZE - 1; p->aHash[h] >= 0; h = (h + 1) & (HASH_SIZE - 1)) {
+        if (memcmp(&p->aRecord[p->aHash[h]], r, sizeof(*r)) == 0) return p->aHash[h];
+    }
+    p->aRecord[p->nRecord] = *r;
+    p->aHash[h] = p->nRecord;
+    return p->nRecord++;
+}
+
+/*
+** Cuts the code points in blocks of (1 << shift) and their index entries in
+** spans of (1 << spanShift), storing each distinct record, block, span and
+** run of expansions once
+*/
+static void trie_build(trie_t *p, int shift, int spanShift)
+{
+    static unsigned int aPos[TRIE_POINTS];
+    static index_t aFlat[TRIE_POINTS >> MIN_SHIFT];
+    unsigned int size = 1u << shift, span = 1u << spanShift, *aId, c, f, k, b, n;
+    record_t r;
+
+    memset(p, 0, sizeof(*p));
+    memset(p->aHash, 0xFF, sizeof(p->aHash));
+    memset(aFlat, 0, sizeof(aFlat));
+    p->shift = shift;
+    p->spanShift = spanShift;
+    p->nSpan = (CODE_POINTS >> (shift + spanShift)) + 1;
+    p->nPoint = p->nSpan << (shift + spanShift);
+    p->aSpan = malloc(p->nSpan * sizeof(unsigned int));
+    p->aIndex = malloc((p->nPoint >> shift) * sizeof(index_t));
+    p->aId = malloc(p->nPoint * sizeof(unsigned int));
+    p->aRecord = malloc(p->nPoint * sizeof(record_t));
+    p->aData = malloc((nPool + 1) * sizeof(unsigned int));
+    if ((p->aSpan == NULL) || (p->aIndex == NULL) || (p->aId == NULL) || (p->aRecord == NULL)
+        || (p->aData == NULL)) {
+        fail("%s", "out of memory");
+    }
+
+    // the expansions of each block, a run shared by the blocks that have it
+    p->aData[p->nData++] = 0;               // the base of the blocks without expansions
+    for (c = 0; c < (unsigned int) p->nPoint; c += size) {
+        for (k = n = 0; k < size; k++) {
+            aPos[c + k] = n;
+            memcpy(&p->aData[p->nData + n], &aPool[aUnaccAt[c + k]], aUnaccLen[c + k] * sizeof(unsigned int));
+            n += aUnaccLen[c + k];
+        }
+        if (n > 0) {
+            for (k = 1; (k < (unsigned int) p->nData)
+                 && (memcmp(&p->aData[k], &p->aData[p->nData], n * sizeof(unsigned int)) != 0); k++);
+            // a run may overlap the end of the data
+            if (k + n > (unsigned int) p->nData) p->nData = k + n;
+            aFlat[c >> shift].unacc = (unsigned short) k;
+        }
+        if (p->nData > 0xFFFF) fail("%s: too many code points for 16 bit offsets", "unacc");
+    }
+    for (c = 0; c < (unsigned int) p->nPoint; c++) aPos[c] += aFlat[c >> shift].unacc;
+
+    for (c = 0; c < (unsigned int) p->nPoint; c += size) {
+        aId = &p->aId[p->nBlock * size];
+        for (k = 0; k < size; k++) {
+            for (b = 0; b < CASE_COUNT; b++) r.aDelta[b] = aDelta[b][c + k];
+            r.unacc = (unsigned short) (aUnaccLen[c + k] ? aPos[c + k] - aFlat[c >> shift].unacc : 0);
+            r.unaccLen = aUnaccLen[c + k];
+            // fold then unaccent: the expansion of the folded code point,
+            // wherever it is, from the base modulo 0x10000
+            f = PLANE(c + k) | (unsigned short) (c + k + aDelta[0][c + k]);
+            r.foldUnacc = (unsigned short) (aUnaccLen[f] ? aPos[f] - aFlat[c >> shift].unacc : 0);
+            r.foldUnaccLen = aUnaccLen[f];
+            aId[k] = record_id(p, &r);
+        }
+        for (b = 0; b < (unsigned int) p->nBlock; b++) {
+            if (memcmp(&p->aId[b * size], aId, size * sizeof(unsigned int)) == 0) break;
+        }
+        if (b == (unsigned int) p->nBlock) p->nBlock++;
+        aFlat[c >> shift].block = (unsigned short) b;
+    }
+    if (p->nBlock > 0xFFFF) fail("%s: too many blocks for 16 bit indexes", "props");
+
+    for (c = 0; c < (unsigned int) p->nSpan; c++) {
+        for (b = 0; b < (unsigned int) p->nSpanBlock; b++) {
+            if (memcmp(&p->aIndex[b * span], &aFlat[c * span], span * sizeof(index_t)) == 0) break;
+        }
+        if (b == (unsigned int) p->nSpanBlock) {
+            memcpy(&p->aIndex[b * span], &aFlat[c * span], span * sizeof(index_t));
+            p->nSpanBlock++;
+        }
+        p->aSpan[c] = b;
+    }
+    p->idBits = width_of(p->nRecord - 1);
+    p->spanBits = width_of(p->nSpanBlock - 1);
+}
+
+static void trie_free(trie_t *p)
+{
+    free(p->aSpan);
+    free(p->aIndex);
+    free(p->aId);
+    free(p->aRecord);
+    free(p->aData);
+}
+
+/*
+** Mask of the indexes of aAstral[], padded to a power of 2 so that any
+** code unit masked reads within it
+*/
+static int astral_mask(void)
+{
+    int mask = 0;
+
+    while (mask + 1 < nAstral) mask = (mask << 1) | 1;
+    return mask;
+}
+
+static long trie_bytes(const trie_t *p)
+{
+    return (long) p->nSpan * (p->spanBits / 8) + ((long) p->nSpanBlock << p->spanShift) * sizeof(index_t)
+           + ((long) p->nBlock << p->shift) * (p->idBits / 8)
+           + (long) p->nRecord * sizeof(record_t) + (long) p->nData * sizeof(unsigned short)
+           + (long) astral_mask() * sizeof(unsigned int) + sizeof(unsigned int);
+}
+
+static void print_array(const char *zType, const char *zName, const char *zSize,
+                        const unsigned int *a, int n, int hex)
+{
+    int i;
+
+    printf("static const %s %s[%s] = {", zType, zName, zSize);
+    for (i = 0; i < n; i++) {
+        if (i % (hex ? 8 : 15) == 0) printf("\n   ");
+        if (hex) printf(" 0x%04X%s", a[i], (i + 1 < n) ? "," : "");
+        else printf(" %3u%s", a[i], (i + 1 < n) ? "," : "");
+    }
+    printf("\n};\n");
+}
+
+static unsigned long long hash_bytes(unsigned long long h, const void *p, size_t n)
+{
+    const unsigned char *z = p;
+    size_t i;
+
+    for (i = 0; i < n; i++) h = (h ^ z[i]) * FNV_PRIME;
+    return h;
+}
+
+static unsigned long long hash_code(unsigned long long h, unsigned int c)
+{
+    unsigned char z[4];
+
+    z[0] = c & 0xFF; z[1] = (c >> 8) & 0xFF; z[2] = (c >> 16) & 0xFF; z[3] = c >> 24;
+    return hash_bytes(h, z, 4);
+}
+
+/*
+** FNV-1a of the fold, lower, upper and title mappings of every code point,
+** then the length and code points of its expansion, as little endian 32 bit
+** numbers: the same mappings have the same fingerprint in any layout
+*/
+static unsigned long long props_fingerprint(void)
+{
+    unsigned long long h = FNV_BASIS;
+    unsigned int c, u;
+    int t, k;
+
+    for (c = 0; c < CODE_POINTS; c++) {
+        for (t = 0; t < CASE_COUNT; t++) h = hash_code(h, PLANE(c) | (unsigned short) (c + aDelta[t][c]));
+        h = hash_code(h, aUnaccLen[c]);
+        for (k = 0; k < aUnaccLen[c]; k++) {
+            u = aPool[aUnaccAt[c] + k];
+            h = hash_code(h, ((u >= UNACC_ESCAPE) && (u < UNACC_ESCAPE + MAX_ASTRAL)) ? aAstral[u - UNACC_ESCAPE] : u);
+        }
+    }
+    return h;
+}
+
+static const char *type_of(int bits)
+{
+    return (bits == 8) ? "u8" : (bits == 16) ? "u16" : "u32";
+}
+
+static void trie_print(const trie_t *p)
+{
+    const record_t *r;
+    int i, n;
+
+    printf("\n/* props: %d spans of %d, %d blocks of %d, %d records, %d expansion code units, %ld bytes */\n",
+           p->nSpanBlock, 1 << p->spanShift, p->nBlock, 1 << p->shift, p->nRecord, p->nData, trie_bytes(p));
+    printf("#define PROPS_BLOCK_SHIFT %d\n", p->shift);
+    printf("#define PROPS_BLOCK_MASK ((1 << PROPS_BLOCK_SHIFT) - 1)\n");
+    printf("#define PROPS_BLOCK_COUNT %d\n", p->nBlock);
+    printf("#define PROPS_SPAN_SHIFT %d\n", p->spanShift);
+    printf("#define PROPS_SPAN_MASK ((1 << PROPS_SPAN_SHIFT) - 1)\n");
+    printf("#define PROPS_SPAN_COUNT %d\n", p->nSpanBlock);
+    printf("#define PROPS_SPANS_SIZE %d\n", p->nSpan);
+    printf("#define PROPS_RECORD_COUNT %d\n", p->nRecord);
+    printf("#define UNACC_DATA_SIZE %d\n", p->nData);
+    printf("#define UNACC_ESCAPE 0x%04X\n", UNACC_ESCAPE);
+    printf("#define UNACC_ASTRAL_COUNT %d\n", nAstral);
+    printf("#define UNACC_ASTRAL_MASK %d\n", astral_mask());
+    printf("#define PROPS_FINGERPRINT 0x%016llXULL\n", props_fingerprint());
+    printf("\n"
+           "typedef %s PropsSpanT;\n"
+           "typedef %s PropsIdT;\n"
+           "\n"
+           "typedef struct codePropsIndex_ {\n"
+           "    u16 block;                  /* of record numbers in props_blocks[] */\n"
+           "    u16 unacc;                  /* base of the expansions of the block */\n"
+           "} CodePropsIndexT;\n"
+           "\n"
+           "typedef struct codeProps_ {\n"
+           "    u16 fold;                   /* mappings as deltas modulo 0x10000 */\n"
+           "    u16 lower;\n"
+           "    u16 upper;\n"
+           "    u16 title;\n"
+           "    u16 unacc;                  /* expansion: offset from the base */\n"
+           "    u16 foldUnacc;              /* fold then unaccent: offset modulo 0x10000 */\n"
+           "    u8 unaccLength;             /* their lengths, 0 for none */\n"
+           "    u8 foldUnaccLength;\n"
+           "} CodePropsT;\n"
+           "\n", type_of(p->spanBits), type_of(p->idBits));
+    print_array("PropsSpanT", "props_spans", "PROPS_SPANS_SIZE", p->aSpan, p->nSpan, 0);
+    n = p->nSpanBlock << p->spanShift;
+    printf("static const CodePropsIndexT props_indexes[PROPS_SPAN_COUNT << PROPS_SPAN_SHIFT] = {");
+    for (i = 0; i < n; i++) {
+        if (i % 8 == 0) printf("\n   ");
+        printf(" {%3u,%5u}%s", p->aIndex[i].block, p->aIndex[i].unacc, (i + 1 < n) ? "," : "");
+    }
+    printf("\n};\n");
+    print_array("PropsIdT", "props_blocks", "PROPS_BLOCK_COUNT << PROPS_BLOCK_SHIFT", p->aId,
+                p->nBlock << p->shift, 0);
+    printf("static const CodePropsT props_records[PROPS_RECORD_COUNT] = {");
+    for (i = 0; i < p->nRecord; i++) {
+        r = &p->aRecord[i];
+        if (i % 2 == 0) printf("\n   ");
+        printf(" {0x%04X,0x%04X,0x%04X,0x%04X,%2u,0x%04X,%2u,%2u}%s", r->aDelta[0], r->aDelta[1],
+               r->aDelta[2], r->aDelta[3], r->unacc, r->foldUnacc, r->unaccLen, r->foldUnaccLen,
+               (i + 1 < p->nRecord) ? "," : "");
+    }
+    printf("\n};\n");
+    print_array("u16", "unacc_data", "UNACC_DATA_SIZE", p->aData, p->nData, 1);
+    print_array("u32", "unacc_astral", "UNACC_ASTRAL_MASK + 1", aAstral, astral_mask() + 1, 1);
+}
+
+/*
+** Lookups of all the properties of n code points, summed so that none of
+** them is optimized away
+*/
+#define LOOKUP_PROPS(name, IT)                                                  \
+static unsigned int name(const trie_t *p, const void *pId, const unsigned int *aCode, int n) \
+{                                                                               \
+    const IT *aId = pId;                                                        \
+    const index_t *pIndex;                                                      \
+    const record_t *r;                                                          \
+    unsigned int shift = p->shift, mask = (1u << shift) - 1, sum = 0;           \
+    unsigned int spanShift = p->spanShift, spanMask = (1u << spanShift) - 1, s; \
+    int i;                                                                      \
+    for (i = 0; i < n; i++) {                                                   \
+        s = aCode[i] >> (shift + spanShift);                                    \
+        s = (s < (unsigned int) p->nSpan - 1) ? s : (unsigned int) p->nSpan - 1; \
+        pIndex = &p->aIndex[(p->aSpan[s] << spanShift) | ((aCode[i] >> shift) & spanMask)]; \
+        r = &p->aRecord[aId[((unsigned int) pIndex->block << shift) | (aCode[i] & mask)]]; \
+        sum += r->aDelta[0] + r->aDelta[1] + r->aDelta[2] + r->aDelta[3]        \
+             + r->unaccLen + p->aData[pIndex->unacc + r->unacc]                 \
+             + r->foldUnaccLen + p->aData[(unsigned short) (pIndex->unacc + r->foldUnacc)]; \
+    }                                                                           \
+    return sum;                                                                 \
+}
+
+LOOKUP_PROPS(lookup_8, unsigned char)
+LOOKUP_PROPS(lookup_16, unsigned short)
+LOOKUP_PROPS(lookup_32, unsigned int)
+
+typedef unsigned int (*lookup_t)(const trie_t *, const void *, const unsigned int *, int);
+
+static void *narrow(const unsigned int *a, int n, int bits)
+{
+    void *p = malloc((size_t) n * (bits / 8) + 1);
+    int i;
+
+    if (p == NULL) fail("%s", "out of memory");
+    for (i = 0; i < n; i++) {
+        if (bits == 8) ((unsigned char *) p)[i] = (unsigned char) a[i];
+        else if (bits == 16) ((unsigned short *) p)[i] = (unsigned short) a[i];
+        else ((unsigned int *) p)[i] = a[i];
+    }
+    return p;
+}
+
+/*
+** Writes the table to zFile in the binary format of unifuzz: the header,
+** then spans, index entries, record numbers, records, expansions and
+** astral code points, each at a multiple of 8 bytes, in the byte order of
+** the host.  The checksum covers everything after it.
+*/
+static void trie_write(const trie_t *p, const char *zFile)
+{
+    file_header_t h;
+    const void *apArray[FILE_ARRAYS];
+    size_t aSize[FILE_ARRAYS], at;
+    unsigned char *z;
+    FILE *f;
+    int i;
+
+    memset(&h, 0, sizeof(h));
+    memcpy(h.zMagic, FILE_MAGIC, sizeof(h.zMagic));
+    h.fingerprint = props_fingerprint();
+    h.version = FILE_VERSION;
+    h.byteOrder = 0x01020304;
+    h.blockShift = (unsigned char) p->shift;
+    h.spanShift = (unsigned char) p->spanShift;
+    h.spanBits = (unsigned char) p->spanBits;
+    h.idBits = (unsigned char) p->idBits;
+    h.spansSize = p->nSpan;
+    h.spanCount = p->nSpanBlock;
+    h.blockCount = p->nBlock;
+    h.recordCount = p->nRecord;
+    h.dataSize = p->nData;
+    h.astralCount = nAstral;
+    h.astralMask = astral_mask();
+
+    apArray[0] = narrow(p->aSpan, p->nSpan, p->spanBits);
+    apArray[1] = p->aIndex;
+    apArray[2] = narrow(p->aId, p->nBlock << p->shift, p->idBits);
+    apArray[3] = p->aRecord;
+    apArray[4] = narrow(p->aData, p->nData, 16);
+    apArray[5] = aAstral;
+    aSize[0] = (size_t) p->nSpan * (p->spanBits / 8);
+    aSize[1] = ((size_t) p->nSpanBlock << p->spanShift) * sizeof(index_t);
+    aSize[2] = ((size_t) p->nBlock << p->shift) * (p->idBits / 8);
+    aSize[3] = (size_t) p->nRecord * sizeof(record_t);
+    aSize[4] = (size_t) p->nData * sizeof(unsigned short);
+    aSize[5] = (size_t) (h.astralMask + 1) * sizeof(unsigned int);
+    for (at = sizeof(h), i = 0; i < FILE_ARRAYS; i++) {
+        at = (at + 7) & ~(size_t) 7;
+        h.aOffset[i] = (unsigned int) at;
+        at += aSize[i];
+    }
+    h.size = (unsigned int) ((at + 7) & ~(size_t) 7);
+
+    if ((z = calloc(h.size, 1)) == NULL) fail("%s", "out of memory");
+    for (i = 0; i < FILE_ARRAYS; i++) memcpy(&z[h.aOffset[i]], apArray[i], aSize[i]);
+    memcpy(z, &h, sizeof(h));
+    at = sizeof(h.zMagic) + sizeof(h.checksum);
+    h.checksum = hash_bytes(FNV_BASIS, &z[at], h.size - at);
+    memcpy(z, &h, sizeof(h));
+
+    if ((f = fopen(zFile, "wb")) == NULL) fail("cannot create %s", zFile);
+    at = fwrite(z, 1, h.size, f);
+    if ((fclose(f) != 0) || (at != h.size)) fail("cannot write %s", zFile);
+    free((void *) apArray[0]);
+    free((void *) apArray[2]);
+    free((void *) apArray[4]);
+    free(z);
+}
+
+static double now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static volatile unsigned int bench_sum;
+
+/*
+** Best time of BENCH_RUNS runs of BENCH_LOOKUPS lookups of aCode, in ns per lookup
+*/
+static double bench_lookups(lookup_t xLookup, const trie_t *p, const void *pId,
+                            const unsigned int *aCode, int nCode)
+{
+    double t, best = 0;
+    int run, done;
+
+    for (run = 0; run < BENCH_RUNS; run++) {
+        t = now();
+        for (done = 0; done < BENCH_LOOKUPS; done += nCode) {
+            bench_sum += xLookup(p, pId, aCode, nCode);
+        }
+        t = (now() - t) * 1e9 / done;
+        if ((run == 0) || (t < best)) best = t;
+    }
+    return best;
+}
+
+static void bench_table(int shift, int spanShift, int idBits, const unsigned int *aSample, int nSample,
+                        const unsigned int *aRandom, int nRandom)
+{
+    static trie_t trie;
+    lookup_t xLookup;
+    void *pId;
+    int s;
+
+    printf("shift  ids  spans  blocks  records     bytes  sample ns  random ns\n");
+    for (s = 3; (s <= 10) && (s + spanShift <= MAX_SHIFTS); s++) {
+        trie_build(&trie, s, spanShift);
+        if (idBits > trie.idBits) trie.idBits = idBits;
+        pId = narrow(trie.aId, trie.nBlock << s, trie.idBits);
+        xLookup = (trie.idBits == 8) ? lookup_8 : (trie.idBits == 16) ? lookup_16 : lookup_32;
+        printf("%c%4d %4d %6d %7d %8d %9ld", (s == shift) ? '*' : ' ', s, trie.idBits, trie.nSpanBlock,
+               trie.nBlock, trie.nRecord, trie_bytes(&trie));
+        printf(" %10.2f", bench_lookups(xLookup, &trie, pId, aSample, nSample));
+        printf(" %10.2f\n", bench_lookups(xLookup, &trie, pId, aRandom, nRandom));
+        fflush(stdout);
+        free(pId);
+        trie_free(&trie);
+    }
+}
+
+/*
+** Reads the code points of a UTF-8 file
+*/
+static unsigned int *read_sample(const char *zFile, int *pnCode)
+{
+    FILE *f = fopen(zFile, "rb");
+    unsigned int *aCode, c;
+    int n = 0, nAlloc = 1 << 16, b, k;
+
+    if (f == NULL) fail("cannot open %s", zFile);
+    aCode = malloc(nAlloc * sizeof(unsigned int));
+    while (aCode && ((b = getc(f)) != EOF)) {
+        if (b < 0x80) { c = b; k = 0; }
+        else if (b < 0xE0) { c = b & 0x1F; k = 1; }
+        else if (b < 0xF0) { c = b & 0x0F; k = 2; }
+        else { c = b & 0x07; k = 3; }
+        while (k-- > 0) c = (c << 6) | (getc(f) & 0x3F);
+        if ((c >= CODE_POINTS) || (c == '\n')) continue;
+        if (n == nAlloc) aCode = realloc(aCode, (nAlloc *= 2) * sizeof(unsigned int));
+        if (aCode) aCode[n++] = c;
+    }
+    fclose(f);
+    if ((aCode == NULL) || (n == 0)) fail("no code point in %s", zFile);
+    *pnCode = n;
+    return aCode;
+}
+
+int main(int argc, char **argv)
+{
+    static trie_t trie;
+    static unsigned int aRandom[1 << 20];
+    unsigned int *aSample = NULL, x = 2463534242u;
+    const char *zOut = NULL;
+    int i, k, t, nSample = 0, shift = 3, spanShift = 6, idBits = 0;
+
+    for (i = 1; i < argc; i++) {
+        if ((argv[i][0] == '-') && (i + 1 < argc)) {
+            k = atoi(argv[i + 1]);
+            switch (argv[i][1]) {
+            case 'b':
+                aSample = read_sample(argv[i + 1], &nSample);
+                break;
+            case 's':
+                if ((k < MIN_SHIFT) || (k > MAX_SHIFT)) fail("bad shift %s", argv[i + 1]);
+                shift = k;
+                break;
+            case 't':
+                if ((k < MIN_SPAN_SHIFT) || (k > MAX_SPAN_SHIFT)) fail("bad span shift %s", argv[i + 1]);
+                spanShift = k;
+                break;
+            case 'i':
+                if ((k != 0) && (k != 8) && (k != 16) && (k != 32)) fail("bad record number width %s", argv[i + 1]);
+                idBits = k;
+                break;
+            case 'o':
+                zOut = argv[i + 1];
+                break;
+            default:
+                fail("unknown option %s", argv[i]);
+            }
+            i++;
+        } else if (i + 1 < argc) {
+            for (t = 0; (t < TABLE_COUNT) && (strcmp(argv[i], azTable[t]) != 0); t++);
+            if (t == TABLE_COUNT) fail("unknown table %s", argv[i]);
+            read_table(t, argv[++i]);
+        } else {
+            fail("missing file after %s", argv[i]);
+        }
+    }
+
+    if (aSample) {
+        for (k = 0; k < (1 << 20); k++) {
+            x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+            aRandom[k] = x & 0xFFFF;
+        }
+        bench_table(shift, spanShift, idBits, aSample, nSample, aRandom, 1 << 20);
+        free(aSample);
+        return 0;
+    }
+    if (shift + spanShift > MAX_SHIFTS) fail("%s: the shifts add up to more than 16", "props");
+    trie_build(&trie, shift, spanShift);
+    if (idBits) {
+        if (trie.idBits > idBits) fail("%s: too many records for the record number width", "props");
+        trie.idBits = idBits;
+    }
+    if (zOut) {
+        trie_write(&trie, zOut);
+        trie_free(&trie);
+        return 0;
+    }
+    printf("/*\n"
+           "** Generated by tools/mktables from the mappings of tools/tables.  Do not\n"
+           "** edit: see tools/mktables.c for the layout, the Makefile for the shifts.\n"
+           "*/\n");
+    trie_print(&trie);
+    trie_free(&trie);
+    return 0;
+}
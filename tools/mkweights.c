@@ -0,0 +1,150 @@
+/*
+**     mkweights - flattens the Wine collation tables for unifuzz (build tool)
+**
+**     Copyright (C) 2017,2025  Daniel Moore
+**
+**     This program is free software: you can redistribute it and/or modify
+**     it under the terms of the GNU General Public License as published by
+**     the Free Software Foundation, either version 3 of the License, or
+**     (at your option) any later version.
+**
+**     This program is distributed in the hope that it will be useful,
+**     but WITHOUT ANY WARRANTY; without even the implied warranty of
+**     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**     GNU General Public License for more details.
+**
+**     You should have received a copy of the GNU General Public License
+**     along with this program.  If not, see [http://www.gnu.org/licenses/].
+**
+**
+** The collations and sort keys of unifuzz.c order strings on the weights of
+** the two-level collation_table of wine/libs/wine/collation.c, and NAMES also
+** on the symbol test of the two-level wine_wctype_table of
+** wine/libs/wine/wctype.c.  This tool writes both as a single direct-indexed
+** table of 65536 entries to stdout, so that each code unit costs one load.
+** The generated header is all that unifuzz.c takes from Wine: the extension
+** itself links no Wine code on any platform.
+**
+**
+**      bits 31..16     unicode (primary) weight
+**      bits 15..8      diacritic weight
+**      bits  7..4      case weight
+**      bit   3         no collation element, compare the code unit itself
+**      bit   1         punctuation or space, skipped under NORM_IGNORESYMBOLS
+**      bit   0         hyphen or apostrophe, skipped in the unicode weights
+**                      pass without SORT_STRINGSORT
+**
+** Code units without collation element have all weights 0.
+**
+** It also writes coll_canon[], the canonical code unit of each code unit:
+** the lowest one with the same unicode and diacritic weights (row 0), or
+** the same unicode weight (row 1).  Code units without collation element,
+** nulls and surrogates stand for themselves.
+**
+** And coll_abbrev[], the code of the unicode weight of each code unit for
+** rmnocase_abbrev(): the distinct unicode weights, in order, numbered with
+** codes of one byte for those of the code units below U+0180, and of two
+** bytes (a lead byte, then 0 to 255) for the others.  The bytes of the codes
+** run from 0x01 to 0xFE, so that a code is never the prefix of another one,
+** codes compare as their weights do, and 0xFF can start the code units
+** without collation element, whose code is 0.
+**
+** Build with the host compiler, along with collation.c and wctype.c:
+**
+**      cc -Iwine/include -DWINE_UNICODE_API="" tools/mkweights.c \
+**         wine/libs/wine/collation.c wine/libs/wine/wctype.c -o mkweights
+**      ./mkweights > unifuzz_weights.h
+*/
+#include <stdio.h>
+#include "wine/unicode.h"
+
+extern const unsigned int collation_table[];
+
+#define COLL_NO_ELEMENT     0x08
+#define COLL_SYMBOL         0x02
+#define COLL_HYPHEN         0x01
+
+static unsigned short first_weight[0x10000];
+static unsigned short first_diacritic[0x1000000];
+static unsigned char weight_used[0x10000];     /* 1: weight of a code unit, 2: one below ABBREV_ONE_BYTE */
+static unsigned short abbrev_code[0x10000];
+
+#define ABBREV_ONE_BYTE     0x180
+
+#define CANON_OF_ITSELF(c, ce)  (((ce) == 0xFFFFFFFF) || ((c) == 0) || (((c) >= 0xD800) && ((c) < 0xE000)))
+
+int main(void)
+{
+    unsigned int c, ce, w, row, next = 0x01, lead = 0, second = 0;
+
+    printf("/*\n"
+           "** Generated by tools/mkweights from the Wine collation and character type\n"
+           "** tables.  Do not edit: see tools/mkweights.c for the entry layout.\n"
+           "*/\n"
+           "#define COLL_NO_ELEMENT     0x%02X\n"
+           "#define COLL_SYMBOL         0x%02X\n"
+           "#define COLL_HYPHEN         0x%02X\n"
+           "\n"
+           "static const u32 coll_weights[0x10000] = {\n",
+           COLL_NO_ELEMENT, COLL_SYMBOL, COLL_HYPHEN);
+    for (c = 0; c < 0x10000; c++) {
+        ce = collation_table[collation_table[c >> 8] + (c & 0xFF)];
+        w = (ce == 0xFFFFFFFF) ? COLL_NO_ELEMENT : (ce & 0xFFFFFFF0);
+        if (get_char_typeW(c) & (C1_PUNCT | C1_SPACE)) w |= COLL_SYMBOL;
+        if ((c == '-') || (c == '\'')) w |= COLL_HYPHEN;
+        printf("%s0x%08X,%s", (c % 8) ? " " : "    ", w, ((c % 8) == 7) ? "\n" : "");
+    }
+    printf("};\n");
+
+    for (c = 0xFFFF; c > 0; c--) {
+        ce = collation_table[collation_table[c >> 8] + (c & 0xFF)];
+        if (CANON_OF_ITSELF(c, ce)) continue;
+        first_weight[ce >> 16] = c;
+        first_diacritic[ce >> 8] = c;
+    }
+    printf("\n"
+           "static const u16 coll_canon[2][0x10000] = {\n");
+    for (row = 0; row < 2; row++) {
+        printf("  {\n");
+        for (c = 0; c < 0x10000; c++) {
+            ce = collation_table[collation_table[c >> 8] + (c & 0xFF)];
+            if (CANON_OF_ITSELF(c, ce)) w = c;
+            else w = row ? first_weight[ce >> 16] : first_diacritic[ce >> 8];
+            printf("%s0x%04X,%s", (c % 8) ? " " : "    ", w, ((c % 8) == 7) ? "\n" : "");
+        }
+        printf("  },\n");
+    }
+    printf("};\n");
+
+    for (c = 0; c < 0x10000; c++) {
+        ce = collation_table[collation_table[c >> 8] + (c & 0xFF)];
+        if (ce == 0xFFFFFFFF) continue;
+        weight_used[ce >> 16] |= (c < ABBREV_ONE_BYTE) ? 3 : 1;
+    }
+    for (w = 0; w < 0x10000; w++) {
+        if (!weight_used[w]) continue;
+        if (weight_used[w] & 2) {
+            abbrev_code[w] = next++;
+            lead = 0;
+        } else {
+            if ((lead == 0) || (second > 0xFF)) {
+                lead = next++;
+                second = 0;
+            }
+            abbrev_code[w] = (lead << 8) | second++;
+        }
+        if (next > 0xFF) {
+            fprintf(stderr, "mkweights: the abbreviated key codes need more than 254 bytes\n");
+            return 1;
+        }
+    }
+    printf("\n"
+           "static const u16 coll_abbrev[0x10000] = {\n");
+    for (c = 0; c < 0x10000; c++) {
+        ce = collation_table[collation_table[c >> 8] + (c & 0xFF)];
+        w = (ce == 0xFFFFFFFF) ? 0 : abbrev_code[ce >> 16];
+        printf("%s0x%04X,%s", (c % 8) ? " " : "    ", w, ((c % 8) == 7) ? "\n" : "");
+    }
+    printf("};\n");
+    return 0;
+}
@@ -23,7 +23,7 @@
 **              locale-invariant Unicode support for casing and collation
 **              various utility functions
 **
-**  warning:    uses Windows CompareStringW() comparison function
+**  warning:    collations follow Windows CompareStringW() invariant order
 **
 **  notes:      this loadable extension is currently intended to be built as a
 **              single Win32 DLL file.  This is a work in progress, bear with it.
@@ -88,12 +88,10 @@
 **
 **              The fuzzy compare is also portable, with the same disclaimer.
 **
-**         |    Unfortunately and even if I tried hard other approaches, the two
-**         |    collation functions rely on MickeySoft XP CompareStringW function,
-**         |    which makes them non portable outside Win 32-64 world.
-**         |    It should be possible to come up with, say, a Un*x equivalent or
-**         |    at least end up with something very close but I can't help for
-**         |    that anytime soon.
+**         |    The collations follow the order of MickeySoft XP CompareStringW
+**         |    function with the invariant locale, but no longer call it: they
+**         |    compare on the Wine collation weights embedded at build time, so
+**         |    they order strings identically on every platform.
 **         |
 **         |    If ever one of those collations is used to build indices, then they
 **         |    \\\_MUST_/// be rebuilt if the underlying compare function changes.
@@ -332,6 +330,11 @@
 **            FOLD(str)
 **                  returns a Unicode folded version of str
 **
+**            PHONETIC(str)
+**                  returns the Soundex code of unaccent(fold(str)): its first
+**                  letter followed by 3 digits, as in 'R163' for Robert and
+**                  Rupert.  Only ASCII letters count; '' if there is none.
+**
 **            str2 LIKE str1 [ESCAPE esc]
 **            LIKE(str1, str2 [, esc])
 **            LIKEU(str1, str2 [, esc])
@@ -438,13 +441,12 @@
 **      Collation functions
 **      -------------------
 **
-**         |        These collations are just wrappers around a Windows call!
-**         |        The current implementation should work consistently on all
-**         |        Windows 32-64 versions, as long as MS doesn't change the
-**         |        behavior of this function (which is rather unlikely).
+**         |        These collations reproduce the invariant order of the
+**         |        Windows CompareStringW call from embedded weights, so they
+**         |        give the same results on every platform and build.
 **         |
 **         |        Any index built on one of these collations will have to be
-**         |        rebuilt if ever the Windows function used changes!
+**         |        rebuilt if ever the embedded weights change!
 **         |
 **         |        Observe that since the collations compare modified data
 **         |        (unaccented strings for NOCASE[U] and NAMES, numeric part
@@ -452,12 +454,16 @@
 **         |        on indices using these collations.  This is nothing new: the
 **         |        same remark applies to the built-in NOCASE as well.
 **
+**                  Every collation is registered for UTF-8 as well as UTF-16LE, so that UTF-8
+**                  bases don't pay for the conversion of both keys to UTF-16
+**                  at every compare.  Both versions give identical results.
+**
 **
 **            NOCASE
 **            NOCASEU
 **            RMNOCASE
 **                  this basic function overrides the built-in function and
-**                  handles Unicode strings using the CompareStringW Win32
+**                  handles Unicode strings like the CompareStringW Win32
 **                  call with "locale-invariant" and IGNORECASE parameters.
 **                  If you need locale-specific collation with the highly specific
 **                  behavior for a locale, then you should probably use ICU instead.
@@ -465,7 +471,7 @@
 **                  of the table as well as the ICU and Unicode versions!
 **
 **            UNACCENTED
-**                  handles Unicode strings using the CompareStringW Win32
+**                  handles Unicode strings like the CompareStringW Win32
 **                  call with "locale-independant" parameter similarly to NOCASE
 **                  but also ignores diacritics.
 **
@@ -483,12 +489,167 @@
 **                  conversion accepts leading whitespaces (all sorts of Unicode
 **                  whitespaces are OK), one optional sign (all sorts of + and -
 **                  are OK) then optional numeric part (all sorts of Unicode digits
-**                  are OK) but it doesn't check for signed 64-bit integer overflow.
+**                  are OK).  Numbers are compared by value whatever their number
+**                  of digits: they are not limited to 64-bit integers.
 **                  Conversion stops at the first non-digit.  Nulls yield zero.
 **                  In cases where numeric prefixes yield the same value, then the
 **                  non-numeric part of the strings, if any, are then compared
 **                  with NOCASE collation.
 **
+**            NATURAL
+**                  "natural" order for titles mixing words and numbers: runs of
+**                  digits (all sorts of Unicode digits are OK) are compared by
+**                  value wherever both strings have one, so that "Box 2" sorts
+**                  before "Box 10", and the rest is compared with the weights
+**                  of RMNOCASE.  Runs of digits of the same value compare equal.
+**                  NATURAL is an SQL keyword: quote it, as in COLLATE "NATURAL".
+**
+**            RMNOCASE_KEY(str)
+**            UNACCENTED_KEY(str)
+**            NAMES_KEY(str)
+**                  return a blob sort key for str: comparing the keys of two
+**                  strings as blobs gives the same order as comparing the
+**                  strings with the RMNOCASE, UNACCENTED or NAMES collation.
+**                  Keys can be stored, indexed or compared by any tool that
+**                  doesn't know about these collations.  They are innocuous,
+**                  so expression indexes and generated columns may use them
+**                  with PRAGMA trusted_schema = OFF.  Null yields null.
+**
+**          |       A character without collation weight (most CJK, Hangul,
+**          |       private use, ...) is compared to any other character by
+**          |       code point, which isn't transitive.  Keys may disagree with
+**          |       the collation where such a character is the first difference
+**          |       and faces one that has a weight; an index built with the
+**          |       collation has the same ambiguity.
+**
+**            RMNOCASE_ABBREV(str)
+**                  return a signed integer that orders str as RMNOCASE does,
+**                  from its first characters only (8 Latin letters, fewer
+**                  for other scripts): when str1 < str2 with RMNOCASE, the
+**                  integer of str1 is less than or equal to the one of str2,
+**                  and equal strings give equal integers.  Equal integers
+**                  need a full compare, as in ORDER BY rmnocase_abbrev(Surname),
+**                  Surname.  Null yields null.
+**
+**            RMNOCASE_CANON(str)
+**            UNACCENTED_CANON(str)
+**            NAMES_CANON(str)
+**            RMNOCASE_HASH(str)
+**            UNACCENTED_HASH(str)
+**            NAMES_HASH(str)
+**                  return the canonical form of str for the RMNOCASE, UNACCENTED
+**                  or NAMES collation, or its 64-bit integer hash: two strings
+**                  are equal with the collation if and only if their canonical
+**                  forms are equal as BINARY strings, and then their hashes are
+**                  equal too.  Group, join or deduplicate by them instead of a
+**                  collated sort.  Null yields null.
+**
+**            UNIFUZZ_KEYCACHE(on [, bytes])
+**            UNIFUZZ_KEYCACHE()
+**                  With on true, makes the NOCASE, RMNOCASE, UNACCENTED and
+**                  NAMES collations of the connection memoize the weights of
+**                  the keys they compare, within a budget of <bytes> (16 MiB
+**                  by default); with on false, empties and disables the cache.
+**                  Results never change.  Without argument, returns the state,
+**                  memory used, hits, misses, hit rate and evictions as text.
+**                  The cache doesn't pay for itself with short keys: measure
+**                  before enabling it.
+**
+**            UNIFUZZ_FINGERPRINT()
+**                  Returns 16 hexadecimal digits identifying the ordering of
+**                  the loaded collations: versions, flags and weight tables.
+**
+**            UNIFUZZ_TABLES()
+**                  Returns the fingerprint of the case and accent tables in
+**                  use, then where they come from: the table file named by
+**                  the UNIFUZZ_TABLES environment variable, mapped when the
+**                  extension is first loaded, or "compiled", followed by the
+**                  reason a table file was refused.
+**
+**            UNIFUZZ_NEEDS_REINDEX([schema [, meta]])
+**            UNIFUZZ_MARK_REINDEXED([schema [, meta]])
+**                  After rebuilding the indexes of <schema> (main by default),
+**                  UNIFUZZ_MARK_REINDEXED records the fingerprint in the table
+**                  unifuzz_meta of <meta> (<schema> by default), which it
+**                  creates: pass an attached sidecar base as <meta> to leave
+**                  the tree itself unchanged.  UNIFUZZ_NEEDS_REINDEX then
+**                  returns 0 as long as the fingerprint recorded in <meta> is
+**                  the current one, or when no index of <schema> uses the
+**                  collations, 1 otherwise.  Rows written by another
+**                  implementation of the collations aren't detected.
+**
+**            SELECT * FROM UNIFUZZ_CHECK_INDEXES([schema])
+**                  Table-valued function reading each index of <schema> that
+**                  uses a unifuzz collation in its own order, and comparing
+**                  every key to the previous one with the loaded collations.
+**                  Columns: tbl, idx, rows, violations, first_row, first_key
+**                  (position and key of the first out of order row).  Rows
+**                  is null for the indexes it skips: partial indexes and
+**                  indexes on expressions.  A linear scan, much cheaper than
+**                  a REINDEX.
+**
+**            UNIFUZZ_REINDEX_FAILING([schema])
+**                  Rebuilds the indexes UNIFUZZ_CHECK_INDEXES finds out of
+**                  order and returns how many.
+**
+**            UNIFUZZ_REINDEX(index_or_collation [, budget_ms])
+**            UNIFUZZ_REINDEX_STATUS()
+**                  Rebuilds the named index, or the indexes of schema main
+**                  using the named collation, one at a time until <budget_ms>
+**                  have passed, and returns how many indexes are left.  Call
+**                  it again until it returns 0: each call being a transaction
+**                  of its own in autocommit mode, other connections get their
+**                  turn in between.  UNIFUZZ_REINDEX_STATUS() reports indexes
+**                  and rows rebuilt, rows per second and the estimated time
+**                  left.
+**
+**            UNIFUZZ_SIDECAR(sidecar, table, column)
+**                  Creates or refreshes, in the attached database <sidecar>,
+**                  the table <table>_<column>(id, value, fold, unaccented,
+**                  key, phonetic) with the rowid of each row of <table> in
+**                  main, its <column>, fold(), unaccent(fold()),
+**                  RMNOCASE_KEY() and PHONETIC(), all four indexed.  Only
+**                  changed, new and deleted rows are rewritten, unless the
+**                  fingerprint of the collations or of the case and accent
+**                  tables changed.  Returns how many
+**                  rows were written or deleted.  Join back by rowid:
+**                        select n.* from sc.NameTable_Surname k
+**                          join NameTable n on n.rowid = k.id
+**                          where k.phonetic = phonetic('Smyth');
+**
+**            SELECT completion FROM UNIFUZZ_COMPLETE(table, column, prefix [, k])
+**                  Table-valued function returning the first k (10 by default)
+**                  values of <column> in <table> of main, in RMNOCASE order,
+**                  that start with <prefix> for RMNOCASE: case and accents
+**                  don't matter, and equal values come once.  Each value is
+**                  one seek: with an index on the column using RMNOCASE,
+**                  the cost depends on k, not on the size of the table,
+**                  unlike column LIKE 'prefix%'.
+**
+**            SELECT lo, hi FROM LIKE_RANGES(pattern [, esc])
+**                  Table-valued function returning ascending, disjoint ranges
+**                  of RMNOCASE such that any string matching <pattern> with
+**                  the LIKE of this extension lies in one of them, so that
+**                  an index using RMNOCASE only reads those ranges:
+**                        select n.* from like_ranges('smi%') r
+**                          join NameTable n on n.Surname >= r.lo
+**                                          and n.Surname < r.hi
+**                          where n.Surname like 'smi%';
+**                  The LIKE still filters the rows: ranges are a superset.
+**                  Several ranges are needed where LIKE and RMNOCASE see
+**                  a character differently (U+0282 matches s, U+0142 matches l but
+**                  don't sort with them).  Hi is an empty blob, above any
+**                  text, when the range has no upper bound.  Strings using
+**                  characters RMNOCASE has no weight for, other than those
+**                  of the pattern itself, may be left out.
+**
+**            LIKE_LOWER_BOUND(pattern [, esc])
+**            LIKE_UPPER_BOUND(pattern [, esc])
+**                  return the lo of the first range and the hi of the last
+**                  range of LIKE_RANGES: a single range, wider, for
+**                  column >= like_lower_bound('smi%')
+**                  and column < like_upper_bound('smi%').
+**
 **
 **      Convenience functions
 **      ---------------------
@@ -568,55 +729,23 @@ extern "C" {
 SQLITE_EXTENSION_INIT1
 
 #include <assert.h>
-#ifndef __APPLE__
-#ifndef WIN32
-#include <wchar.h>
-#include <windef.h>
-#include "windef.h"
-#include "winbase.h"
-#include "winuser.h"
-#include "winnls.h"
-#endif
-#endif
-
-#ifdef __APPLE__
-typedef unsigned long DWORD;
-typedef void* LPVOID;
-typedef int BOOL;
-
-#define TRUE 1
-#define FALSE 0
-
+#include <stdlib.h>
 #include <string.h>
-#include <wchar.h>
-#include <stdint.h>
-
-// Windows-style defines
-#define LOCALE_INVARIANT      0x007f
-#define NORM_IGNORECASE       0x00000001
-#define NORM_IGNORENONSPACE   0x00000002
-#define NORM_IGNORESYMBOLS    0x00000004
-#define NORM_IGNOREWIDTH      0x00000008
-#define NORM_IGNOREKANATYPE   0x00010000
-#define SORT_STRINGSORT       0x00001000
-
-typedef uint16_t u16;
-
-// Stub version of CompareStringW: best-effort fallback
-int CompareStringW(int locale, int flags, const u16 *str1, int len1, const u16 *str2, int len2) {
-    int cmp = wcsncasecmp((const wchar_t *)str1, (const wchar_t *)str2, (len1 < len2 ? len1 : len2));
-    if (cmp < 0) return 1;
-    if (cmp > 0) return 3;
-    return 2;
-}
-#endif
-
-#ifndef NO_WINDOWS_COLLATION
-#ifdef WIN32
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
 #include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
 #endif
-
 #ifndef SQLITE_PRIVATE
 # define SQLITE_PRIVATE static
 #endif
@@ -802,1888 +931,428 @@ typedef UINT8_TYPE     u8;         /* 1-byte unsigned integer */
 
 
 
-/* Generated by builder. Do not modify. Start fold_defines */
-#define FOLD_BLOCK_SHIFT 5
-#define FOLD_BLOCK_MASK ((1 << FOLD_BLOCK_SHIFT) - 1)
-#define FOLD_BLOCK_SIZE (1 << FOLD_BLOCK_SHIFT)
-#define FOLD_BLOCK_COUNT 69
-#define FOLD_INDEXES_SIZE (0x10000 >> FOLD_BLOCK_SHIFT)
-/* Generated by builder. Do not modify. End fold_defines */
-
-
-/* Generated by builder. Do not modify. Start fold_tables */
-static const u16 fold_indexes[FOLD_INDEXES_SIZE] = {
-   0,   0,   1,   0,   0,   2,   3,   0,   4,   5,   6,   7,   8,   9,  10,
-  11,  12,  13,  14,   0,   0,   0,   0,   0,   0,   0,  15,  16,  17,  18,
-  19,  20,  21,  22,   0,  23,  24,  25,  26,  27,  28,  29,  30,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  31,  32,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,
-  48,   0,   0,   0,   0,   0,   0,   0,   0,   0,  49,   0,  50,  51,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,  52,  53,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,  54,  55,   0,  56,  57,  58,  59,  60,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  61,  62,  63,   0,   0,
-   0,   0,  64,  65,  66,  67,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,  68,   0,   0,   0,   0,   0,   0
+/*
+** Case folding, case mappings and unaccenting
+**
+** All the properties of a code point, U+0000 to U+10FFFF, come from a
+** single record of the three-stage table of unifuzz_tables.h, which the
+** Makefile generates with tools/mktables from the mappings of tools/tables,
+** with the shifts set there (make bench_tables weighs them).  The case
+** mappings are deltas modulo 0x10000 within the plane of the code point,
+** 0 leaving it unchanged, so that no code point needs a branch.  The
+** unaccented expansion of the code point, and that of its folded code
+** point which LIKE and TYPOS compare, are offsets modulo 0x10000 from the
+** base of its block in unacc_data[].  Expansions are 16 bit code units:
+** the few code points above the BMP are escaped to unacc_astral[] by code
+** units from UNACC_ESCAPE, surrogates that no expansion holds.
+**
+** The arrays are read through props_tables, so that a table file of the
+** same layout, mapped at load time, can stand in for the compiled ones (see
+** props_load()).
+*/
+#include "unifuzz_tables.h"
+
+typedef struct propsTables_ {
+    const PropsSpanT *spans;
+    const CodePropsIndexT *indexes;
+    const PropsIdT *blocks;
+    const CodePropsT *records;
+    const u16 *unacc;
+    const u32 *astral;
+    u32 astralCount;
+    u32 astralMask;
+    sqlite3_uint64 fingerprint;         /* of the mappings, by content */
+} PropsTablesT;
+
+static PropsTablesT props_tables = {
+    props_spans, props_indexes, props_blocks, props_records, unacc_data, unacc_astral,
+    UNACC_ASTRAL_COUNT, UNACC_ASTRAL_MASK, PROPS_FINGERPRINT
 };
 
-static const u16 fold_data0[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data1[]  = { 0x0000, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data2[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03BC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data3[]  = { 0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF, 0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x0000, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x0000 };
-static const u16 fold_data4[]  = { 0x0101, 0x0000, 0x0103, 0x0000, 0x0105, 0x0000, 0x0107, 0x0000, 0x0109, 0x0000, 0x010B, 0x0000, 0x010D, 0x0000, 0x010F, 0x0000, 0x0111, 0x0000, 0x0113, 0x0000, 0x0115, 0x0000, 0x0117, 0x0000, 0x0119, 0x0000, 0x011B, 0x0000, 0x011D, 0x0000, 0x011F, 0x0000 };
-static const u16 fold_data5[]  = { 0x0121, 0x0000, 0x0123, 0x0000, 0x0125, 0x0000, 0x0127, 0x0000, 0x0129, 0x0000, 0x012B, 0x0000, 0x012D, 0x0000, 0x012F, 0x0000, 0x0000, 0x0000, 0x0133, 0x0000, 0x0135, 0x0000, 0x0137, 0x0000, 0x0000, 0x013A, 0x0000, 0x013C, 0x0000, 0x013E, 0x0000, 0x0140 };
-static const u16 fold_data6[]  = { 0x0000, 0x0142, 0x0000, 0x0144, 0x0000, 0x0146, 0x0000, 0x0148, 0x0000, 0x0000, 0x014B, 0x0000, 0x014D, 0x0000, 0x014F, 0x0000, 0x0151, 0x0000, 0x0153, 0x0000, 0x0155, 0x0000, 0x0157, 0x0000, 0x0159, 0x0000, 0x015B, 0x0000, 0x015D, 0x0000, 0x015F, 0x0000 };
-static const u16 fold_data7[]  = { 0x0161, 0x0000, 0x0163, 0x0000, 0x0165, 0x0000, 0x0167, 0x0000, 0x0169, 0x0000, 0x016B, 0x0000, 0x016D, 0x0000, 0x016F, 0x0000, 0x0171, 0x0000, 0x0173, 0x0000, 0x0175, 0x0000, 0x0177, 0x0000, 0x00FF, 0x017A, 0x0000, 0x017C, 0x0000, 0x017E, 0x0000, 0x0073 };
-static const u16 fold_data8[]  = { 0x0000, 0x0253, 0x0183, 0x0000, 0x0185, 0x0000, 0x0254, 0x0188, 0x0000, 0x0256, 0x0257, 0x018C, 0x0000, 0x0000, 0x01DD, 0x0259, 0x025B, 0x0192, 0x0000, 0x0260, 0x0263, 0x0000, 0x0269, 0x0268, 0x0199, 0x0000, 0x0000, 0x0000, 0x026F, 0x0272, 0x0000, 0x0275 };
-static const u16 fold_data9[]  = { 0x01A1, 0x0000, 0x01A3, 0x0000, 0x01A5, 0x0000, 0x0280, 0x01A8, 0x0000, 0x0283, 0x0000, 0x0000, 0x01AD, 0x0000, 0x0288, 0x01B0, 0x0000, 0x028A, 0x028B, 0x01B4, 0x0000, 0x01B6, 0x0000, 0x0292, 0x01B9, 0x0000, 0x0000, 0x0000, 0x01BD, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data10[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x01C6, 0x01C6, 0x0000, 0x01C9, 0x01C9, 0x0000, 0x01CC, 0x01CC, 0x0000, 0x01CE, 0x0000, 0x01D0, 0x0000, 0x01D2, 0x0000, 0x01D4, 0x0000, 0x01D6, 0x0000, 0x01D8, 0x0000, 0x01DA, 0x0000, 0x01DC, 0x0000, 0x0000, 0x01DF, 0x0000 };
-static const u16 fold_data11[] = { 0x01E1, 0x0000, 0x01E3, 0x0000, 0x01E5, 0x0000, 0x01E7, 0x0000, 0x01E9, 0x0000, 0x01EB, 0x0000, 0x01ED, 0x0000, 0x01EF, 0x0000, 0x0000, 0x01F3, 0x01F3, 0x0000, 0x01F5, 0x0000, 0x0195, 0x01BF, 0x01F9, 0x0000, 0x01FB, 0x0000, 0x01FD, 0x0000, 0x01FF, 0x0000 };
-static const u16 fold_data12[] = { 0x0201, 0x0000, 0x0203, 0x0000, 0x0205, 0x0000, 0x0207, 0x0000, 0x0209, 0x0000, 0x020B, 0x0000, 0x020D, 0x0000, 0x020F, 0x0000, 0x0211, 0x0000, 0x0213, 0x0000, 0x0215, 0x0000, 0x0217, 0x0000, 0x0219, 0x0000, 0x021B, 0x0000, 0x021D, 0x0000, 0x021F, 0x0000 };
-static const u16 fold_data13[] = { 0x019E, 0x0000, 0x0223, 0x0000, 0x0225, 0x0000, 0x0227, 0x0000, 0x0229, 0x0000, 0x022B, 0x0000, 0x022D, 0x0000, 0x022F, 0x0000, 0x0231, 0x0000, 0x0233, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2C65, 0x023C, 0x0000, 0x019A, 0x2C66, 0x0000 };
-static const u16 fold_data14[] = { 0x0000, 0x0242, 0x0000, 0x0180, 0x0289, 0x028C, 0x0247, 0x0000, 0x0249, 0x0000, 0x024B, 0x0000, 0x024D, 0x0000, 0x024F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data15[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03B9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data16[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0371, 0x0000, 0x0373, 0x0000, 0x0000, 0x0000, 0x0377, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data17[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03AC, 0x0000, 0x03AD, 0x03AE, 0x03AF, 0x0000, 0x03CC, 0x0000, 0x03CD, 0x03CE, 0x0000, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF };
-static const u16 fold_data18[] = { 0x03C0, 0x03C1, 0x0000, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x03CA, 0x03CB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data19[] = { 0x0000, 0x0000, 0x03C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03D7, 0x03B2, 0x03B8, 0x0000, 0x0000, 0x0000, 0x03C6, 0x03C0, 0x0000, 0x03D9, 0x0000, 0x03DB, 0x0000, 0x03DD, 0x0000, 0x03DF, 0x0000 };
-static const u16 fold_data20[] = { 0x03E1, 0x0000, 0x03E3, 0x0000, 0x03E5, 0x0000, 0x03E7, 0x0000, 0x03E9, 0x0000, 0x03EB, 0x0000, 0x03ED, 0x0000, 0x03EF, 0x0000, 0x03BA, 0x03C1, 0x0000, 0x0000, 0x03B8, 0x03B5, 0x0000, 0x03F8, 0x0000, 0x03F2, 0x03FB, 0x0000, 0x0000, 0x037B, 0x037C, 0x037D };
-static const u16 fold_data21[] = { 0x0450, 0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457, 0x0458, 0x0459, 0x045A, 0x045B, 0x045C, 0x045D, 0x045E, 0x045F, 0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F };
-static const u16 fold_data22[] = { 0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data23[] = { 0x0461, 0x0000, 0x0463, 0x0000, 0x0465, 0x0000, 0x0467, 0x0000, 0x0469, 0x0000, 0x046B, 0x0000, 0x046D, 0x0000, 0x046F, 0x0000, 0x0471, 0x0000, 0x0473, 0x0000, 0x0475, 0x0000, 0x0477, 0x0000, 0x0479, 0x0000, 0x047B, 0x0000, 0x047D, 0x0000, 0x047F, 0x0000 };
-static const u16 fold_data24[] = { 0x0481, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x048B, 0x0000, 0x048D, 0x0000, 0x048F, 0x0000, 0x0491, 0x0000, 0x0493, 0x0000, 0x0495, 0x0000, 0x0497, 0x0000, 0x0499, 0x0000, 0x049B, 0x0000, 0x049D, 0x0000, 0x049F, 0x0000 };
-static const u16 fold_data25[] = { 0x04A1, 0x0000, 0x04A3, 0x0000, 0x04A5, 0x0000, 0x04A7, 0x0000, 0x04A9, 0x0000, 0x04AB, 0x0000, 0x04AD, 0x0000, 0x04AF, 0x0000, 0x04B1, 0x0000, 0x04B3, 0x0000, 0x04B5, 0x0000, 0x04B7, 0x0000, 0x04B9, 0x0000, 0x04BB, 0x0000, 0x04BD, 0x0000, 0x04BF, 0x0000 };
-static const u16 fold_data26[] = { 0x04CF, 0x04C2, 0x0000, 0x04C4, 0x0000, 0x04C6, 0x0000, 0x04C8, 0x0000, 0x04CA, 0x0000, 0x04CC, 0x0000, 0x04CE, 0x0000, 0x0000, 0x04D1, 0x0000, 0x04D3, 0x0000, 0x04D5, 0x0000, 0x04D7, 0x0000, 0x04D9, 0x0000, 0x04DB, 0x0000, 0x04DD, 0x0000, 0x04DF, 0x0000 };
-static const u16 fold_data27[] = { 0x04E1, 0x0000, 0x04E3, 0x0000, 0x04E5, 0x0000, 0x04E7, 0x0000, 0x04E9, 0x0000, 0x04EB, 0x0000, 0x04ED, 0x0000, 0x04EF, 0x0000, 0x04F1, 0x0000, 0x04F3, 0x0000, 0x04F5, 0x0000, 0x04F7, 0x0000, 0x04F9, 0x0000, 0x04FB, 0x0000, 0x04FD, 0x0000, 0x04FF, 0x0000 };
-static const u16 fold_data28[] = { 0x0501, 0x0000, 0x0503, 0x0000, 0x0505, 0x0000, 0x0507, 0x0000, 0x0509, 0x0000, 0x050B, 0x0000, 0x050D, 0x0000, 0x050F, 0x0000, 0x0511, 0x0000, 0x0513, 0x0000, 0x0515, 0x0000, 0x0517, 0x0000, 0x0519, 0x0000, 0x051B, 0x0000, 0x051D, 0x0000, 0x051F, 0x0000 };
-static const u16 fold_data29[] = { 0x0521, 0x0000, 0x0523, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567, 0x0568, 0x0569, 0x056A, 0x056B, 0x056C, 0x056D, 0x056E, 0x056F };
-static const u16 fold_data30[] = { 0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577, 0x0578, 0x0579, 0x057A, 0x057B, 0x057C, 0x057D, 0x057E, 0x057F, 0x0580, 0x0581, 0x0582, 0x0583, 0x0584, 0x0585, 0x0586, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data31[] = { 0x2D00, 0x2D01, 0x2D02, 0x2D03, 0x2D04, 0x2D05, 0x2D06, 0x2D07, 0x2D08, 0x2D09, 0x2D0A, 0x2D0B, 0x2D0C, 0x2D0D, 0x2D0E, 0x2D0F, 0x2D10, 0x2D11, 0x2D12, 0x2D13, 0x2D14, 0x2D15, 0x2D16, 0x2D17, 0x2D18, 0x2D19, 0x2D1A, 0x2D1B, 0x2D1C, 0x2D1D, 0x2D1E, 0x2D1F };
-static const u16 fold_data32[] = { 0x2D20, 0x2D21, 0x2D22, 0x2D23, 0x2D24, 0x2D25, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data33[] = { 0x1E01, 0x0000, 0x1E03, 0x0000, 0x1E05, 0x0000, 0x1E07, 0x0000, 0x1E09, 0x0000, 0x1E0B, 0x0000, 0x1E0D, 0x0000, 0x1E0F, 0x0000, 0x1E11, 0x0000, 0x1E13, 0x0000, 0x1E15, 0x0000, 0x1E17, 0x0000, 0x1E19, 0x0000, 0x1E1B, 0x0000, 0x1E1D, 0x0000, 0x1E1F, 0x0000 };
-static const u16 fold_data34[] = { 0x1E21, 0x0000, 0x1E23, 0x0000, 0x1E25, 0x0000, 0x1E27, 0x0000, 0x1E29, 0x0000, 0x1E2B, 0x0000, 0x1E2D, 0x0000, 0x1E2F, 0x0000, 0x1E31, 0x0000, 0x1E33, 0x0000, 0x1E35, 0x0000, 0x1E37, 0x0000, 0x1E39, 0x0000, 0x1E3B, 0x0000, 0x1E3D, 0x0000, 0x1E3F, 0x0000 };
-static const u16 fold_data35[] = { 0x1E41, 0x0000, 0x1E43, 0x0000, 0x1E45, 0x0000, 0x1E47, 0x0000, 0x1E49, 0x0000, 0x1E4B, 0x0000, 0x1E4D, 0x0000, 0x1E4F, 0x0000, 0x1E51, 0x0000, 0x1E53, 0x0000, 0x1E55, 0x0000, 0x1E57, 0x0000, 0x1E59, 0x0000, 0x1E5B, 0x0000, 0x1E5D, 0x0000, 0x1E5F, 0x0000 };
-static const u16 fold_data36[] = { 0x1E61, 0x0000, 0x1E63, 0x0000, 0x1E65, 0x0000, 0x1E67, 0x0000, 0x1E69, 0x0000, 0x1E6B, 0x0000, 0x1E6D, 0x0000, 0x1E6F, 0x0000, 0x1E71, 0x0000, 0x1E73, 0x0000, 0x1E75, 0x0000, 0x1E77, 0x0000, 0x1E79, 0x0000, 0x1E7B, 0x0000, 0x1E7D, 0x0000, 0x1E7F, 0x0000 };
-static const u16 fold_data37[] = { 0x1E81, 0x0000, 0x1E83, 0x0000, 0x1E85, 0x0000, 0x1E87, 0x0000, 0x1E89, 0x0000, 0x1E8B, 0x0000, 0x1E8D, 0x0000, 0x1E8F, 0x0000, 0x1E91, 0x0000, 0x1E93, 0x0000, 0x1E95, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1E61, 0x0000, 0x0000, 0x00DF, 0x0000 };
-static const u16 fold_data38[] = { 0x1EA1, 0x0000, 0x1EA3, 0x0000, 0x1EA5, 0x0000, 0x1EA7, 0x0000, 0x1EA9, 0x0000, 0x1EAB, 0x0000, 0x1EAD, 0x0000, 0x1EAF, 0x0000, 0x1EB1, 0x0000, 0x1EB3, 0x0000, 0x1EB5, 0x0000, 0x1EB7, 0x0000, 0x1EB9, 0x0000, 0x1EBB, 0x0000, 0x1EBD, 0x0000, 0x1EBF, 0x0000 };
-static const u16 fold_data39[] = { 0x1EC1, 0x0000, 0x1EC3, 0x0000, 0x1EC5, 0x0000, 0x1EC7, 0x0000, 0x1EC9, 0x0000, 0x1ECB, 0x0000, 0x1ECD, 0x0000, 0x1ECF, 0x0000, 0x1ED1, 0x0000, 0x1ED3, 0x0000, 0x1ED5, 0x0000, 0x1ED7, 0x0000, 0x1ED9, 0x0000, 0x1EDB, 0x0000, 0x1EDD, 0x0000, 0x1EDF, 0x0000 };
-static const u16 fold_data40[] = { 0x1EE1, 0x0000, 0x1EE3, 0x0000, 0x1EE5, 0x0000, 0x1EE7, 0x0000, 0x1EE9, 0x0000, 0x1EEB, 0x0000, 0x1EED, 0x0000, 0x1EEF, 0x0000, 0x1EF1, 0x0000, 0x1EF3, 0x0000, 0x1EF5, 0x0000, 0x1EF7, 0x0000, 0x1EF9, 0x0000, 0x1EFB, 0x0000, 0x1EFD, 0x0000, 0x1EFF, 0x0000 };
-static const u16 fold_data41[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F00, 0x1F01, 0x1F02, 0x1F03, 0x1F04, 0x1F05, 0x1F06, 0x1F07, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F10, 0x1F11, 0x1F12, 0x1F13, 0x1F14, 0x1F15, 0x0000, 0x0000 };
-static const u16 fold_data42[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F20, 0x1F21, 0x1F22, 0x1F23, 0x1F24, 0x1F25, 0x1F26, 0x1F27, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F30, 0x1F31, 0x1F32, 0x1F33, 0x1F34, 0x1F35, 0x1F36, 0x1F37 };
-static const u16 fold_data43[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F40, 0x1F41, 0x1F42, 0x1F43, 0x1F44, 0x1F45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F51, 0x0000, 0x1F53, 0x0000, 0x1F55, 0x0000, 0x1F57 };
-static const u16 fold_data44[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F60, 0x1F61, 0x1F62, 0x1F63, 0x1F64, 0x1F65, 0x1F66, 0x1F67, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data45[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F80, 0x1F81, 0x1F82, 0x1F83, 0x1F84, 0x1F85, 0x1F86, 0x1F87, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F90, 0x1F91, 0x1F92, 0x1F93, 0x1F94, 0x1F95, 0x1F96, 0x1F97 };
-static const u16 fold_data46[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1FA0, 0x1FA1, 0x1FA2, 0x1FA3, 0x1FA4, 0x1FA5, 0x1FA6, 0x1FA7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1FB0, 0x1FB1, 0x1F70, 0x1F71, 0x1FB3, 0x0000, 0x03B9, 0x0000 };
-static const u16 fold_data47[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F72, 0x1F73, 0x1F74, 0x1F75, 0x1FC3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1FD0, 0x1FD1, 0x1F76, 0x1F77, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data48[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1FE0, 0x1FE1, 0x1F7A, 0x1F7B, 0x1FE5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F78, 0x1F79, 0x1F7C, 0x1F7D, 0x1FF3, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data49[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03C9, 0x0000, 0x0000, 0x0000, 0x006B, 0x00E5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x214E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data50[] = { 0x2170, 0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176, 0x2177, 0x2178, 0x2179, 0x217A, 0x217B, 0x217C, 0x217D, 0x217E, 0x217F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data51[] = { 0x0000, 0x0000, 0x0000, 0x2184, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data52[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24D0, 0x24D1, 0x24D2, 0x24D3, 0x24D4, 0x24D5, 0x24D6, 0x24D7, 0x24D8, 0x24D9 };
-static const u16 fold_data53[] = { 0x24DA, 0x24DB, 0x24DC, 0x24DD, 0x24DE, 0x24DF, 0x24E0, 0x24E1, 0x24E2, 0x24E3, 0x24E4, 0x24E5, 0x24E6, 0x24E7, 0x24E8, 0x24E9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data54[] = { 0x2C30, 0x2C31, 0x2C32, 0x2C33, 0x2C34, 0x2C35, 0x2C36, 0x2C37, 0x2C38, 0x2C39, 0x2C3A, 0x2C3B, 0x2C3C, 0x2C3D, 0x2C3E, 0x2C3F, 0x2C40, 0x2C41, 0x2C42, 0x2C43, 0x2C44, 0x2C45, 0x2C46, 0x2C47, 0x2C48, 0x2C49, 0x2C4A, 0x2C4B, 0x2C4C, 0x2C4D, 0x2C4E, 0x2C4F };
-static const u16 fold_data55[] = { 0x2C50, 0x2C51, 0x2C52, 0x2C53, 0x2C54, 0x2C55, 0x2C56, 0x2C57, 0x2C58, 0x2C59, 0x2C5A, 0x2C5B, 0x2C5C, 0x2C5D, 0x2C5E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data56[] = { 0x2C61, 0x0000, 0x026B, 0x1D7D, 0x027D, 0x0000, 0x0000, 0x2C68, 0x0000, 0x2C6A, 0x0000, 0x2C6C, 0x0000, 0x0251, 0x0271, 0x0250, 0x0000, 0x0000, 0x2C73, 0x0000, 0x0000, 0x2C76, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data57[] = { 0x2C81, 0x0000, 0x2C83, 0x0000, 0x2C85, 0x0000, 0x2C87, 0x0000, 0x2C89, 0x0000, 0x2C8B, 0x0000, 0x2C8D, 0x0000, 0x2C8F, 0x0000, 0x2C91, 0x0000, 0x2C93, 0x0000, 0x2C95, 0x0000, 0x2C97, 0x0000, 0x2C99, 0x0000, 0x2C9B, 0x0000, 0x2C9D, 0x0000, 0x2C9F, 0x0000 };
-static const u16 fold_data58[] = { 0x2CA1, 0x0000, 0x2CA3, 0x0000, 0x2CA5, 0x0000, 0x2CA7, 0x0000, 0x2CA9, 0x0000, 0x2CAB, 0x0000, 0x2CAD, 0x0000, 0x2CAF, 0x0000, 0x2CB1, 0x0000, 0x2CB3, 0x0000, 0x2CB5, 0x0000, 0x2CB7, 0x0000, 0x2CB9, 0x0000, 0x2CBB, 0x0000, 0x2CBD, 0x0000, 0x2CBF, 0x0000 };
-static const u16 fold_data59[] = { 0x2CC1, 0x0000, 0x2CC3, 0x0000, 0x2CC5, 0x0000, 0x2CC7, 0x0000, 0x2CC9, 0x0000, 0x2CCB, 0x0000, 0x2CCD, 0x0000, 0x2CCF, 0x0000, 0x2CD1, 0x0000, 0x2CD3, 0x0000, 0x2CD5, 0x0000, 0x2CD7, 0x0000, 0x2CD9, 0x0000, 0x2CDB, 0x0000, 0x2CDD, 0x0000, 0x2CDF, 0x0000 };
-static const u16 fold_data60[] = { 0x2CE1, 0x0000, 0x2CE3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data61[] = { 0xA641, 0x0000, 0xA643, 0x0000, 0xA645, 0x0000, 0xA647, 0x0000, 0xA649, 0x0000, 0xA64B, 0x0000, 0xA64D, 0x0000, 0xA64F, 0x0000, 0xA651, 0x0000, 0xA653, 0x0000, 0xA655, 0x0000, 0xA657, 0x0000, 0xA659, 0x0000, 0xA65B, 0x0000, 0xA65D, 0x0000, 0xA65F, 0x0000 };
-static const u16 fold_data62[] = { 0x0000, 0x0000, 0xA663, 0x0000, 0xA665, 0x0000, 0xA667, 0x0000, 0xA669, 0x0000, 0xA66B, 0x0000, 0xA66D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data63[] = { 0xA681, 0x0000, 0xA683, 0x0000, 0xA685, 0x0000, 0xA687, 0x0000, 0xA689, 0x0000, 0xA68B, 0x0000, 0xA68D, 0x0000, 0xA68F, 0x0000, 0xA691, 0x0000, 0xA693, 0x0000, 0xA695, 0x0000, 0xA697, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data64[] = { 0x0000, 0x0000, 0xA723, 0x0000, 0xA725, 0x0000, 0xA727, 0x0000, 0xA729, 0x0000, 0xA72B, 0x0000, 0xA72D, 0x0000, 0xA72F, 0x0000, 0x0000, 0x0000, 0xA733, 0x0000, 0xA735, 0x0000, 0xA737, 0x0000, 0xA739, 0x0000, 0xA73B, 0x0000, 0xA73D, 0x0000, 0xA73F, 0x0000 };
-static const u16 fold_data65[] = { 0xA741, 0x0000, 0xA743, 0x0000, 0xA745, 0x0000, 0xA747, 0x0000, 0xA749, 0x0000, 0xA74B, 0x0000, 0xA74D, 0x0000, 0xA74F, 0x0000, 0xA751, 0x0000, 0xA753, 0x0000, 0xA755, 0x0000, 0xA757, 0x0000, 0xA759, 0x0000, 0xA75B, 0x0000, 0xA75D, 0x0000, 0xA75F, 0x0000 };
-static const u16 fold_data66[] = { 0xA761, 0x0000, 0xA763, 0x0000, 0xA765, 0x0000, 0xA767, 0x0000, 0xA769, 0x0000, 0xA76B, 0x0000, 0xA76D, 0x0000, 0xA76F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA77A, 0x0000, 0xA77C, 0x0000, 0x1D79, 0xA77F, 0x0000 };
-static const u16 fold_data67[] = { 0xA781, 0x0000, 0xA783, 0x0000, 0xA785, 0x0000, 0xA787, 0x0000, 0x0000, 0x0000, 0x0000, 0xA78C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 fold_data68[] = { 0x0000, 0xFF41, 0xFF42, 0xFF43, 0xFF44, 0xFF45, 0xFF46, 0xFF47, 0xFF48, 0xFF49, 0xFF4A, 0xFF4B, 0xFF4C, 0xFF4D, 0xFF4E, 0xFF4F, 0xFF50, 0xFF51, 0xFF52, 0xFF53, 0xFF54, 0xFF55, 0xFF56, 0xFF57, 0xFF58, 0xFF59, 0xFF5A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-
-static const u16 *fold_data_table[FOLD_BLOCK_COUNT] = {
-fold_data0,fold_data1,fold_data2,fold_data3,fold_data4,fold_data5,fold_data6,fold_data7,fold_data8,fold_data9,
-fold_data10,fold_data11,fold_data12,fold_data13,fold_data14,fold_data15,fold_data16,fold_data17,fold_data18,fold_data19,
-fold_data20,fold_data21,fold_data22,fold_data23,fold_data24,fold_data25,fold_data26,fold_data27,fold_data28,fold_data29,
-fold_data30,fold_data31,fold_data32,fold_data33,fold_data34,fold_data35,fold_data36,fold_data37,fold_data38,fold_data39,
-fold_data40,fold_data41,fold_data42,fold_data43,fold_data44,fold_data45,fold_data46,fold_data47,fold_data48,fold_data49,
-fold_data50,fold_data51,fold_data52,fold_data53,fold_data54,fold_data55,fold_data56,fold_data57,fold_data58,fold_data59,
-fold_data60,fold_data61,fold_data62,fold_data63,fold_data64,fold_data65,fold_data66,fold_data67,fold_data68
-};
-/* Generated by builder. Do not modify. End fold_tables */
+#define PROPS_MAP(c, delta)     (((c) & ~0xFFFFu) | (u16) ((c) + (delta)))
+#define PROPS_UNACC(base, offset)   (&props_tables.unacc[(u16) ((base) + (offset))])
 
-SQLITE_PRIVATE u32 unifuzz_fold(
-    u32 c
+// code point of the code unit u of an expansion; the mask keeps the read of
+// the astral code points in bounds, so that compilers can select without a branch
+#define UNACC_CODE(u)           (((u16) ((u) - UNACC_ESCAPE) < props_tables.astralCount) \
+                                    ? props_tables.astral[((u) - UNACC_ESCAPE) & props_tables.astralMask] : (u32) (u))
+
+/*
+** Record of the properties of the code point c, and in *pBase if not null
+** the base of its expansions.  Past U+10FFFF, the last span of the table,
+** of code points without properties, is read.
+*/
+SQLITE_PRIVATE const CodePropsT *unifuzz_props(
+    u32 c,
+    u16 *pBase
 ){
-    u32 p;
-    if (c >= 0x10000) return c;
-    p = (fold_data_table[fold_indexes[(c) >> FOLD_BLOCK_SHIFT]][(c) & FOLD_BLOCK_MASK]);
-    return (p == 0) ? c : p;
-}
-
-/* Generated by builder. Do not modify. Start unacc_defines */
-#define UNACC_BLOCK_SHIFT 5
-#define UNACC_BLOCK_MASK ((1 << UNACC_BLOCK_SHIFT) - 1)
-#define UNACC_BLOCK_SIZE (1 << UNACC_BLOCK_SHIFT)
-#define UNACC_BLOCK_COUNT 239
-#define UNACC_INDEXES_SIZE (0x10000 >> UNACC_BLOCK_SHIFT)
-/* Generated by builder. Do not modify. End unacc_defines */
-
-/* Generated by builder. Do not modify. Start unacc_tables */
-static const u16 unacc_indexes[UNACC_INDEXES_SIZE] = {
-   0,   0,   0,   0,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,
-  11,  12,  13,  14,  15,  16,  17,  18,  19,   0,   0,   0,  20,  21,  22,
-  23,  24,  25,  26,  27,  28,  29,  30,  31,  32,  33,  34,   0,   0,  35,
-   0,   0,   0,   0,  36,   0,  37,  38,  39,  40,  41,   0,   0,  42,  43,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  44,  45,
-   0,   0,   0,  46,  47,   0,  48,  49,   0,   0,   0,   0,   0,   0,   0,
-  50,   0,  51,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,  52,   0,   0,   0,  53,  54,   0,
-  55,   0,  56,  57,   0,   0,   0,   0,   0,  58,   0,   0,   0,   0,   0,
-  59,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,  60,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,  61,  62,  63,  64,  65,  66,   0,   0,
-  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,  80,  81,
-  82,  83,  84,  85,  86,  87,  88,   0,   0,  89,  90,  91,  92,  93,  94,
-  95,  96,  97,  98,  99, 100, 101, 102,   0, 103,   0, 104,   0, 105, 106,
-   0, 107, 108,   0,   0,   0, 109, 110, 111, 112, 113,   0,   0,   0,   0,
-   0, 114,   0, 115, 116,   0,   0,   0, 117,   0,   0,   0,   0,   0,   0,
-   0,   0,   0, 118, 119,   0,   0,   0,   0,   0,   0,   0,   0, 120, 121,
- 122,   0, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
- 136,   0,   0,   0,   0,   0,   0,   0, 137, 138, 139,   0,   0,   0,   0,
-   0,   0,   0, 140,   0,   0,   0,   0, 141,   0,   0,   0, 142,   0,   0,
- 143, 144, 145, 146, 147, 148, 149, 150,   0, 151, 152, 153, 154, 155, 156,
- 157, 158,   0, 159, 160, 161, 162,   0,   0,   0, 163, 164, 165, 166, 167,
- 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 179,   0, 180,   0,   0,
-   0,   0, 181, 182, 183,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 184, 185, 186,
- 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198,   0, 199, 200,
- 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215,
- 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230,
- 231, 232, 233, 234, 235, 236, 237, 238
-};
+    const CodePropsIndexT *pIndex;
+    u32 span = c >> (PROPS_BLOCK_SHIFT + PROPS_SPAN_SHIFT);
+    span = (span < PROPS_SPANS_SIZE - 1) ? span : PROPS_SPANS_SIZE - 1;
+    pIndex = &props_tables.indexes[((u32) props_tables.spans[span] << PROPS_SPAN_SHIFT) | ((c >> PROPS_BLOCK_SHIFT) & PROPS_SPAN_MASK)];
+    if (pBase) *pBase = pIndex->unacc;
+    return &props_tables.records[props_tables.blocks[((u32) pIndex->block << PROPS_BLOCK_SHIFT) | (c & PROPS_BLOCK_MASK)]];
+}
 
-// This table has been modified to take care of German Eszet (lower- and upper-case)
-static const u16 unacc_positions[UNACC_BLOCK_COUNT][UNACC_BLOCK_SIZE + 1] = {
-/*  0 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/*  1 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 12, 13, 14, 15, 16, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 35, 38, 41, 42 },
-/*  2 */ { 0, 1, 2, 3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 34 },
-/*  3 */ { 0, 1, 2, 3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33 },
-/*  4 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/*  5 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 20, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 35 },
-/*  6 */ { 0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 13, 14, 15, 16, 17, 18, 19, 20, 22, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36 },
-/*  7 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/*  8 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/*  9 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 10 */ { 0, 1, 2, 3, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41 },
-/* 11 */ { 0, 1, 2, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 21, 23, 25, 26, 27, 28, 29, 30, 31, 32, 33, 35, 37, 38, 39 },
-/* 12 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 13 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 14 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 15 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 16 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 17 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 18 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 19 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 20 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 21 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 22 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 23 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 24 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 25 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 26 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 27 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 28 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 29 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 30 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 31 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 32 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 33 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 34 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 35 */ { 0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33 },
-/* 36 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 37 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 23, 25, 27, 29, 30, 31, 32, 33, 34, 35, 36 },
-/* 38 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 39 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 40 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 41 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 42 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 43 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 44 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 45 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 46 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 47 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 48 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 49 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 50 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 51 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 52 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 53 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 54 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 30, 32, 33, 34 },
-/* 55 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 56 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 57 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 58 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 59 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 60 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 61 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 62 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33 },
-/* 63 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 64 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 65 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 66 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 67 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 68 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 69 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 70 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 71 */ //{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 28, 29, 30, 31, 32, 33 },
-/* 71 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 28, 29, 30, 31, 33, 34 },
-/* 72 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 73 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 74 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 75 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 76 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 77 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 78 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 79 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 80 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 81 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 82 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 83 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 84 */ { 0, 1, 2, 3, 4, 5, 7, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 24, 27, 28, 30, 33, 34, 35, 36, 37, 39, 40, 41, 42 },
-/* 85 */ { 0, 1, 2, 3, 4, 5, 6, 7, 9, 11, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 30, 31, 32, 33, 34, 35, 36, 37, 38 },
-/* 86 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 87 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 88 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33 },
-/* 89 */ { 0, 3, 6, 7, 9, 10, 13, 16, 17, 18, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43 },
-/* 90 */ { 0, 2, 5, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 34, 35, 36, 37, 38 },
-/* 91 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 22, 25, 28, 31, 34, 37, 40, 43, 46, 49, 52, 55, 57 },
-/* 92 */ { 0, 1, 3, 6, 8, 9, 11, 14, 18, 20, 21, 23, 26, 27, 28, 29, 30, 31, 33, 36, 38, 39, 41, 44, 48, 50, 51, 53, 56, 57, 58, 59, 60 },
-/* 93 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 94 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 95 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 96 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 97 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 98 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 14, 17, 18, 20, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38 },
-/* 99 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 100 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 101 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 102 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 103 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 104 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 105 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 106 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 107 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 108 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 109 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31, 34, 37, 40, 43, 46, 49, 52, 55, 58, 62, 66, 70 },
-/* 110 */ { 0, 4, 8, 12, 16, 20, 24, 28, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 53, 56, 59, 62, 65, 68, 71, 74, 77, 80, 83, 86, 89, 92, 95 },
-/* 111 */ { 0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33, 36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76 },
-/* 112 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 113 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 114 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 115 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 116 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 117 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 118 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 119 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 120 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 121 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 122 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 123 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 124 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 125 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 126 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 127 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35 },
-/* 128 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 129 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 130 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 23, 25, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37 },
-/* 131 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 132 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 133 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 134 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 135 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 136 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 137 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 138 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 139 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 140 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 141 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 142 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 143 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 144 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 145 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 146 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 147 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 148 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 149 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 150 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 151 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 152 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 153 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 154 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 155 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 33 },
-/* 156 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 157 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 158 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 33 },
-/* 159 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 160 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 161 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 162 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 163 */ { 0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33, 36, 39, 42, 46, 50, 54, 58, 62, 66, 70, 74, 78, 82, 86, 90, 94, 98, 102, 109, 115, 116 },
-/* 164 */ { 0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33, 36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66, 69, 72, 75, 78, 81, 84, 87, 90, 93, 96 },
-/* 165 */ { 0, 3, 6, 9, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 27, 29, 31, 33, 35, 37, 39, 41, 43, 45, 47, 49, 51, 53, 55, 57 },
-/* 166 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 47, 51, 53, 54 },
-/* 167 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 168 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 19, 21, 23, 25, 27, 29, 31, 33, 35, 37, 39, 41, 43, 45, 47 },
-/* 169 */ { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 21, 24, 27, 29, 32, 34, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53 },
-/* 170 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 171 */ { 0, 4, 8, 12, 15, 19, 22, 25, 30, 34, 37, 40, 43, 47, 51, 54, 57, 59, 62, 66, 70, 72, 77, 83, 88, 91, 96, 101, 105, 108, 111, 114, 118 },
-/* 172 */ { 0, 5, 9, 12, 15, 18, 20, 22, 24, 26, 29, 32, 37, 40, 44, 49, 52, 54, 56, 61, 65, 70, 73, 78, 80, 83, 86, 89, 92, 95, 99, 102, 104 },
-/* 173 */ { 0, 3, 6, 9, 13, 16, 19, 22, 27, 31, 33, 38, 40, 44, 48, 51, 54, 57, 61, 63, 66, 70, 72, 77, 80, 82, 84, 86, 88, 90, 92, 94, 96 },
-/* 174 */ { 0, 2, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 34, 37, 40, 43, 46, 49, 52, 54, 56, 59, 61, 63, 65, 68, 71, 73, 75, 77, 79, 81, 85 },
-/* 175 */ { 0, 2, 4, 6, 8, 10, 12, 14, 16, 19, 23, 25, 27, 29, 31, 33, 35, 37, 40, 43, 46, 49, 51, 53, 55, 57, 59, 61, 63, 65, 67, 69, 72 },
-/* 176 */ { 0, 3, 5, 8, 11, 14, 16, 19, 22, 26, 28, 31, 34, 37, 40, 45, 51, 53, 55, 57, 59, 61, 63, 65, 67, 69, 71, 73, 75, 77, 79, 81, 83 },
-/* 177 */ { 0, 2, 4, 8, 10, 12, 14, 18, 21, 23, 25, 27, 29, 31, 33, 35, 37, 39, 41, 44, 46, 48, 51, 54, 56, 60, 63, 65, 67, 69, 71, 74, 77 },
-/* 178 */ { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 21, 24, 27, 30, 33, 36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66, 69, 72, 75, 78, 81, 84, 87 },
-/* 179 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 180 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 181 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 182 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 183 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 184 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 185 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 186 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 187 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 188 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 189 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 190 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 191 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 192 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 193 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 194 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 195 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 196 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 197 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 198 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 199 */ { 0, 2, 4, 6, 9, 12, 14, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 30, 32, 34, 36, 38, 39, 40, 41, 42, 43, 44, 45, 46 },
-/* 200 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 201 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33 },
-/* 202 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 203 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 204 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 205 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 31, 32, 33 },
-/* 206 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 47, 48, 49, 50 },
-/* 207 */ { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64 },
-/* 208 */ { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64 },
-/* 209 */ { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 55, 56, 57, 58, 59 },
-/* 210 */ { 0, 1, 2, 3, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60 },
-/* 211 */ { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 33, 35, 37, 39, 41, 43, 45, 47, 49, 51, 53, 55, 57, 59, 61, 63 },
-/* 212 */ { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64 },
-/* 213 */ { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 51, 53, 55, 57, 59, 61, 63 },
-/* 214 */ { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 37, 38, 39, 41, 43, 45, 47, 49, 51, 53, 55, 57, 59, 61 },
-/* 215 */ { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64 },
-/* 216 */ { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 57, 58, 59, 60 },
-/* 217 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 19, 22, 25, 28, 31, 34, 37, 40, 43, 46, 49, 52, 55, 58, 61, 64 },
-/* 218 */ { 0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33, 36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66, 69, 72, 75, 78, 81, 84, 87, 90, 93, 96 },
-/* 219 */ { 0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33, 36, 39, 42, 45, 48, 49, 50, 53, 56, 59, 62, 65, 68, 71, 74, 77, 80, 83, 86, 89, 92 },
-/* 220 */ { 0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33, 36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66, 69, 72, 75, 78, 81, 84, 87, 90, 93, 96 },
-/* 221 */ { 0, 3, 6, 9, 12, 15, 18, 21, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48 },
-/* 222 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 19, 22, 26, 30, 34, 38, 42, 46, 50, 53, 71, 79, 83, 84, 85, 86 },
-/* 223 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 28, 29, 30, 31, 32, 33, 34 },
-/* 224 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33 },
-/* 225 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 226 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 227 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 228 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 229 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 230 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 23, 25, 27, 29, 31, 33, 35, 37, 38, 39, 40 },
-/* 231 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 232 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 233 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 234 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 235 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 236 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 237 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 },
-/* 238 */ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 }
-};
 
-// This table has been modified to take care of full width characters
-// This table has been modified to take care of German Eszet (lower- and upper-case)
-// This table has been modified to decompose vulgar fraction characters like   ... into the common sequences 1/2 1/4 ... using a common slash '/' (U+002F) instead of the [rare] fraction slash (U+2044) that Unicode mistakenly recommends
-static u32 unacc_data0  [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data1  [] = { 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0028, 0x0043, 0x0029, 0x0061, 0x0000, 0x0000, 0x0000, 0x0028, 0x0052, 0x0029, 0x0020, 0x0000, 0x0000, 0x0032, 0x0033, 0x0020, 0x03BC, 0x0000, 0x0000, 0x0020, 0x0031, 0x006F, 0x0000,
-                               0x0031, 0x002F, 0x0034, 0x0031, 0x002F, 0x0032, 0x0033, 0x002F, 0x0034, 0x0000 };
-static u32 unacc_data2  [] = { 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0045, 0x0043, 0x0045, 0x0045, 0x0045, 0x0045, 0x0049, 0x0049, 0x0049, 0x0049, 0x0000, 0x004E, 0x004F, 0x004F, 0x004F, 0x004F, 0x004F, 0x0000, 0x004F, 0x0055, 0x0055, 0x0055, 0x0055, 0x0059, 0x0000,
-                               0x0073, 0x0073 };
-static u32 unacc_data3  [] = { 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0065, 0x0063, 0x0065, 0x0065, 0x0065, 0x0065, 0x0069, 0x0069, 0x0069, 0x0069, 0x0000, 0x006E, 0x006F, 0x006F, 0x006F, 0x006F, 0x006F, 0x0000, 0x006F, 0x0075, 0x0075, 0x0075, 0x0075, 0x0079, 0x0000, 0x0079 };
-static u32 unacc_data4  [] = { 0x0041, 0x0061, 0x0041, 0x0061, 0x0041, 0x0061, 0x0043, 0x0063, 0x0043, 0x0063, 0x0043, 0x0063, 0x0043, 0x0063, 0x0044, 0x0064, 0x0044, 0x0064, 0x0045, 0x0065, 0x0045, 0x0065, 0x0045, 0x0065, 0x0045, 0x0065, 0x0045, 0x0065, 0x0047, 0x0067, 0x0047, 0x0067 };
-static u32 unacc_data5  [] = { 0x0047, 0x0067, 0x0047, 0x0067, 0x0048, 0x0068, 0x0048, 0x0068, 0x0049, 0x0069, 0x0049, 0x0069, 0x0049, 0x0069, 0x0049, 0x0069, 0x0049, 0x0000, 0x0049, 0x004A, 0x0069, 0x006A, 0x004A, 0x006A, 0x004B, 0x006B, 0x0000, 0x004C, 0x006C, 0x004C, 0x006C, 0x004C,
-                               0x006C, 0x004C, 0x00B7 };
-static u32 unacc_data6  [] = { 0x006C, 0x00B7, 0x004C, 0x006C, 0x004E, 0x006E, 0x004E, 0x006E, 0x004E, 0x006E, 0x02BC, 0x006E, 0x0000, 0x0000, 0x004F, 0x006F, 0x004F, 0x006F, 0x004F, 0x006F, 0x004F, 0x0045, 0x006F, 0x0065, 0x0052, 0x0072, 0x0052, 0x0072, 0x0052, 0x0072, 0x0053, 0x0073,
-                               0x0053, 0x0073, 0x0053, 0x0073 };
-static u32 unacc_data7  [] = { 0x0053, 0x0073, 0x0054, 0x0074, 0x0054, 0x0074, 0x0054, 0x0074, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0057, 0x0077, 0x0059, 0x0079, 0x0059, 0x005A, 0x007A, 0x005A, 0x007A, 0x005A, 0x007A, 0x0073 };
-static u32 unacc_data8  [] = { 0x0062, 0x0042, 0x0042, 0x0062, 0x0000, 0x0000, 0x0000, 0x0043, 0x0063, 0x0000, 0x0044, 0x0044, 0x0064, 0x0000, 0x0000, 0x0000, 0x0000, 0x0046, 0x0066, 0x0047, 0x0000, 0x0000, 0x0000, 0x0049, 0x004B, 0x006B, 0x006C, 0x0000, 0x0000, 0x004E, 0x006E, 0x004F };
-static u32 unacc_data9  [] = { 0x004F, 0x006F, 0x0000, 0x0000, 0x0050, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0074, 0x0054, 0x0074, 0x0054, 0x0055, 0x0075, 0x0000, 0x0056, 0x0059, 0x0079, 0x005A, 0x007A, 0x0000, 0x0000, 0x0000, 0x0292, 0x0000, 0x0000, 0x0000, 0x0296, 0x0000 };
-static u32 unacc_data10 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x005A, 0x0044, 0x007A, 0x0064, 0x007A, 0x004C, 0x004A, 0x004C, 0x006A, 0x006C, 0x006A, 0x004E, 0x004A, 0x004E, 0x006A, 0x006E, 0x006A, 0x0041, 0x0061, 0x0049, 0x0069, 0x004F, 0x006F, 0x0055, 0x0075, 0x0055, 0x0075,
-                               0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0000, 0x0041, 0x0061 };
-static u32 unacc_data11 [] = { 0x0041, 0x0061, 0x0041, 0x0045, 0x0061, 0x0065, 0x0047, 0x0067, 0x0047, 0x0067, 0x004B, 0x006B, 0x004F, 0x006F, 0x004F, 0x006F, 0x01B7, 0x0292, 0x006A, 0x0044, 0x005A, 0x0044, 0x007A, 0x0064, 0x007A, 0x0047, 0x0067, 0x0000, 0x0000, 0x004E, 0x006E, 0x0041,
-                               0x0061, 0x0041, 0x0045, 0x0061, 0x0065, 0x004F, 0x006F };
-static u32 unacc_data12 [] = { 0x0041, 0x0061, 0x0041, 0x0061, 0x0045, 0x0065, 0x0045, 0x0065, 0x0049, 0x0069, 0x0049, 0x0069, 0x004F, 0x006F, 0x004F, 0x006F, 0x0052, 0x0072, 0x0052, 0x0072, 0x0055, 0x0075, 0x0055, 0x0075, 0x0053, 0x0073, 0x0054, 0x0074, 0x0000, 0x0000, 0x0048, 0x0068 };
-static u32 unacc_data13 [] = { 0x004E, 0x0064, 0x0000, 0x0000, 0x005A, 0x007A, 0x0041, 0x0061, 0x0045, 0x0065, 0x004F, 0x006F, 0x004F, 0x006F, 0x004F, 0x006F, 0x004F, 0x006F, 0x0059, 0x0079, 0x006C, 0x006E, 0x0074, 0x0000, 0x0000, 0x0000, 0x0041, 0x0043, 0x0063, 0x004C, 0x0054, 0x0073 };
-static u32 unacc_data14 [] = { 0x007A, 0x0000, 0x0000, 0x0042, 0x0000, 0x0000, 0x0045, 0x0065, 0x004A, 0x006A, 0x0000, 0x0071, 0x0052, 0x0072, 0x0059, 0x0079, 0x0000, 0x0000, 0x0000, 0x0062, 0x0000, 0x0063, 0x0064, 0x0064, 0x0000, 0x0000, 0x0259, 0x0000, 0x0000, 0x025C, 0x0000, 0x0237 };
-static u32 unacc_data15 [] = { 0x0067, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0068, 0xA727, 0x0069, 0x0000, 0x0000, 0x006C, 0x006C, 0x006C, 0x0000, 0x0000, 0x026F, 0x006D, 0x006E, 0x006E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0279, 0x0279, 0x0072, 0x0072, 0x0072, 0x0000 };
-static u32 unacc_data16 [] = { 0x0000, 0x0000, 0x0073, 0x0000, 0x0237, 0x0000, 0x0283, 0x0000, 0x0074, 0x0000, 0x0000, 0x0076, 0x0000, 0x0000, 0x0000, 0x0000, 0x007A, 0x007A, 0x0000, 0x0292, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0262, 0x0000, 0x006A, 0x0000, 0x0000 };
-static u32 unacc_data17 [] = { 0x0071, 0x0294, 0x0000, 0x0000, 0x0000, 0x02A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0265, 0x0265, 0x0068, 0x0068, 0x006A, 0x0072, 0x0279, 0x0279, 0x0281, 0x0077, 0x0079, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data18 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000 };
-static u32 unacc_data19 [] = { 0x0263, 0x006C, 0x0073, 0x0078, 0x0295, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data20 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02B9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x003B, 0x0000 };
-static u32 unacc_data21 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0391, 0x00B7, 0x0395, 0x0397, 0x0399, 0x0000, 0x039F, 0x0000, 0x03A5, 0x03A9, 0x03B9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data22 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0399, 0x03A5, 0x03B1, 0x03B5, 0x03B7, 0x03B9, 0x03C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data23 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03B9, 0x03C5, 0x03BF, 0x03C5, 0x03C9, 0x0000, 0x03B2, 0x03B8, 0x03A5, 0x03A5, 0x03A5, 0x03C6, 0x03C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data24 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03BA, 0x03C1, 0x03C2, 0x0000, 0x0398, 0x03B5, 0x0000, 0x0000, 0x0000, 0x03A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data25 [] = { 0x0415, 0x0415, 0x0000, 0x0413, 0x0000, 0x0000, 0x0000, 0x0406, 0x0000, 0x0000, 0x0000, 0x0000, 0x041A, 0x0418, 0x0423, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0418, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data26 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0438, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data27 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0435, 0x0435, 0x0000, 0x0433, 0x0000, 0x0000, 0x0000, 0x0456, 0x0000, 0x0000, 0x0000, 0x0000, 0x043A, 0x0438, 0x0443, 0x0000 };
-static u32 unacc_data28 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0474, 0x0475, 0x0000, 0x0000, 0x0000, 0x0000, 0x0460, 0x0461, 0x0000, 0x0000 };
-static u32 unacc_data29 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0418, 0x0438, 0x0000, 0x0000, 0x0420, 0x0440, 0x0413, 0x0433, 0x0413, 0x0433, 0x0413, 0x0433, 0x0416, 0x0436, 0x0417, 0x0437, 0x041A, 0x043A, 0x041A, 0x043A, 0x041A, 0x043A };
-static u32 unacc_data30 [] = { 0x0000, 0x0000, 0x041D, 0x043D, 0x0000, 0x0000, 0x041F, 0x043F, 0x0000, 0x0000, 0x0421, 0x0441, 0x0422, 0x0442, 0x0000, 0x0000, 0x04AE, 0x04AF, 0x0425, 0x0445, 0x0000, 0x0000, 0x0427, 0x0447, 0x0427, 0x0447, 0x0000, 0x0000, 0x0000, 0x0000, 0x04BC, 0x04BD };
-static u32 unacc_data31 [] = { 0x0000, 0x0416, 0x0436, 0x041A, 0x043A, 0x041B, 0x043B, 0x041D, 0x043D, 0x041D, 0x043D, 0x0000, 0x0000, 0x041C, 0x043C, 0x0000, 0x0410, 0x0430, 0x0410, 0x0430, 0x0000, 0x0000, 0x0415, 0x0435, 0x0000, 0x0000, 0x04D8, 0x04D9, 0x0416, 0x0436, 0x0417, 0x0437 };
-static u32 unacc_data32 [] = { 0x0000, 0x0000, 0x0418, 0x0438, 0x0418, 0x0438, 0x041E, 0x043E, 0x0000, 0x0000, 0x04E8, 0x04E9, 0x042D, 0x044D, 0x0423, 0x0443, 0x0423, 0x0443, 0x0423, 0x0443, 0x0427, 0x0447, 0x0413, 0x0433, 0x042B, 0x044B, 0x0413, 0x0433, 0x0425, 0x0445, 0x0425, 0x0445 };
-static u32 unacc_data33 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x041B, 0x043B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data34 [] = { 0x041B, 0x043B, 0x041D, 0x043D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data35 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0565, 0x0582, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                               0x0000 };
-static u32 unacc_data36 [] = { 0x0000, 0x0000, 0x0627, 0x0627, 0x0648, 0x0627, 0x064A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x06A9, 0x06A9, 0x06CC, 0x06CC, 0x06CC };
-static u32 unacc_data37 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0627, 0x0627, 0x0000, 0x0627, 0x0674, 0x0648, 0x0674, 0x06C7, 0x0674, 0x064A, 0x0674, 0x0000, 0x0000, 0x0000,
-                               0x062A, 0x062A, 0x0000, 0x0000 };
-static u32 unacc_data38 [] = { 0x0000, 0x062D, 0x062D, 0x0000, 0x0000, 0x062D, 0x0000, 0x0000, 0x0000, 0x062F, 0x062F, 0x062F, 0x0000, 0x0000, 0x0000, 0x062F, 0x062F, 0x0000, 0x0631, 0x0631, 0x0631, 0x0631, 0x0631, 0x0631, 0x0000, 0x0631, 0x0633, 0x0633, 0x0633, 0x0635, 0x0635, 0x0637 };
-static u32 unacc_data39 [] = { 0x0639, 0x0000, 0x0641, 0x0641, 0x0000, 0x0641, 0x0000, 0x0642, 0x0642, 0x0000, 0x0000, 0x0643, 0x0643, 0x0000, 0x0643, 0x0000, 0x06AF, 0x0000, 0x06AF, 0x0000, 0x06AF, 0x0644, 0x0644, 0x0644, 0x0644, 0x0646, 0x0000, 0x0000, 0x0646, 0x0646, 0x0000, 0x0686 };
-static u32 unacc_data40 [] = { 0x06D5, 0x0000, 0x06C1, 0x0000, 0x0648, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0648, 0x0000, 0x0000, 0x064A, 0x064A, 0x0648, 0x0000, 0x064A, 0x0000, 0x06D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data41 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x062F, 0x0631, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0634, 0x0636, 0x063A, 0x0000, 0x0000, 0x0647 };
-static u32 unacc_data42 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0628, 0x0628, 0x0628, 0x0628, 0x0628, 0x0628, 0x0628, 0x062D, 0x062D, 0x062F, 0x062F, 0x0631, 0x0633, 0x0639, 0x0639, 0x0639 };
-static u32 unacc_data43 [] = { 0x0641, 0x0641, 0x06A9, 0x06A9, 0x06A9, 0x0645, 0x0645, 0x0646, 0x0646, 0x0646, 0x0644, 0x0631, 0x0631, 0x0633, 0x062D, 0x062D, 0x0633, 0x0631, 0x062D, 0x0627, 0x0627, 0x06CC, 0x06CC, 0x06CC, 0x0648, 0x0648, 0x06D2, 0x06D2, 0x062D, 0x0633, 0x0633, 0x0643 };
-static u32 unacc_data44 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0928, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0930, 0x0000, 0x0000, 0x0933, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data45 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0915, 0x0916, 0x0917, 0x091C, 0x0921, 0x0922, 0x092B, 0x092F };
-static u32 unacc_data46 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09A1, 0x09A2, 0x0000, 0x09AF };
-static u32 unacc_data47 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09B0, 0x09B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data48 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A32, 0x0000, 0x0000, 0x0A38, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data49 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A16, 0x0A17, 0x0A1C, 0x0000, 0x0000, 0x0A2B, 0x0000 };
-static u32 unacc_data50 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B21, 0x0B22, 0x0000, 0x0000 };
-static u32 unacc_data51 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B92, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data52 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0E32, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data53 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0EB2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data54 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0EAB, 0x0E99, 0x0EAB, 0x0EA1,
-                               0x0000, 0x0000 };
-static u32 unacc_data55 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F0B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data56 [] = { 0x0000, 0x0000, 0x0000, 0x0F42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F4C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F51, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F56, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F5B, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data57 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F40, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data58 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1025, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data59 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10DC, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data60 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1B05, 0x0000, 0x1B07, 0x0000, 0x1B09, 0x0000, 0x1B0B, 0x0000, 0x1B0D, 0x0000, 0x0000, 0x0000, 0x1B11, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data61 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x029F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1D11, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data62 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x0041, 0x0045, 0x0042, 0x0000, 0x0044, 0x0045, 0x018E, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x0000, 0x004F, 0x0222, 0x0050,
-                               0x0052 };
-static u32 unacc_data63 [] = { 0x0054, 0x0055, 0x0057, 0x0061, 0x0250, 0x0251, 0x1D02, 0x0062, 0x0064, 0x0065, 0x0259, 0x025B, 0x025C, 0x0067, 0x0000, 0x006B, 0x006D, 0x014B, 0x006F, 0x0254, 0x1D16, 0x1D17, 0x0070, 0x0074, 0x0075, 0x1D1D, 0x026F, 0x0076, 0x1D25, 0x03B2, 0x03B3, 0x03B4 };
-static u32 unacc_data64 [] = { 0x03C6, 0x03C7, 0x0069, 0x0072, 0x0075, 0x0076, 0x03B2, 0x03B3, 0x03C1, 0x03C6, 0x03C7, 0x0000, 0x0062, 0x0064, 0x0066, 0x006D, 0x006E, 0x0070, 0x0072, 0x0072, 0x0073, 0x0074, 0x007A, 0x0000, 0x043D, 0x0000, 0x0000, 0x0000, 0x0269, 0x0070, 0x0000, 0x028A };
-static u32 unacc_data65 [] = { 0x0062, 0x0064, 0x0066, 0x0067, 0x006B, 0x006C, 0x006D, 0x006E, 0x0070, 0x0072, 0x0073, 0x0283, 0x0076, 0x0078, 0x007A, 0x0061, 0x0251, 0x0064, 0x0065, 0x025B, 0x025C, 0x0259, 0x0069, 0x0254, 0x0283, 0x0075, 0x0292, 0x0252, 0x0063, 0x0063, 0x00F0, 0x025C };
-static u32 unacc_data66 [] = { 0x0066, 0x0237, 0x0261, 0x0265, 0x0069, 0x0269, 0x026A, 0x1D7B, 0x006A, 0x006C, 0x006C, 0x029F, 0x006D, 0x026F, 0x006E, 0x006E, 0x0274, 0x0275, 0x0278, 0x0073, 0x0283, 0x0074, 0x0289, 0x028A, 0x1D1C, 0x0076, 0x028C, 0x007A, 0x007A, 0x007A, 0x0292, 0x03B8 };
-static u32 unacc_data67 [] = { 0x0041, 0x0061, 0x0042, 0x0062, 0x0042, 0x0062, 0x0042, 0x0062, 0x0043, 0x0063, 0x0044, 0x0064, 0x0044, 0x0064, 0x0044, 0x0064, 0x0044, 0x0064, 0x0044, 0x0064, 0x0045, 0x0065, 0x0045, 0x0065, 0x0045, 0x0065, 0x0045, 0x0065, 0x0045, 0x0065, 0x0046, 0x0066 };
-static u32 unacc_data68 [] = { 0x0047, 0x0067, 0x0048, 0x0068, 0x0048, 0x0068, 0x0048, 0x0068, 0x0048, 0x0068, 0x0048, 0x0068, 0x0049, 0x0069, 0x0049, 0x0069, 0x004B, 0x006B, 0x004B, 0x006B, 0x004B, 0x006B, 0x004C, 0x006C, 0x004C, 0x006C, 0x004C, 0x006C, 0x004C, 0x006C, 0x004D, 0x006D };
-static u32 unacc_data69 [] = { 0x004D, 0x006D, 0x004D, 0x006D, 0x004E, 0x006E, 0x004E, 0x006E, 0x004E, 0x006E, 0x004E, 0x006E, 0x004F, 0x006F, 0x004F, 0x006F, 0x004F, 0x006F, 0x004F, 0x006F, 0x0050, 0x0070, 0x0050, 0x0070, 0x0052, 0x0072, 0x0052, 0x0072, 0x0052, 0x0072, 0x0052, 0x0072 };
-static u32 unacc_data70 [] = { 0x0053, 0x0073, 0x0053, 0x0073, 0x0053, 0x0073, 0x0053, 0x0073, 0x0053, 0x0073, 0x0054, 0x0074, 0x0054, 0x0074, 0x0054, 0x0074, 0x0054, 0x0074, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0056, 0x0076, 0x0056, 0x0076 };
-static u32 unacc_data71 [] = { 0x0057, 0x0077, 0x0057, 0x0077, 0x0057, 0x0077, 0x0057, 0x0077, 0x0057, 0x0077, 0x0058, 0x0078, 0x0058, 0x0078, 0x0059, 0x0079, 0x005A, 0x007A, 0x005A, 0x007A, 0x005A, 0x007A, 0x0068, 0x0074, 0x0077, 0x0079, 0x0061, 0x02BE, 0x0073, 0x0073, 0x0073, 0x0053,
-                               0x0053, 0x0000 };
-static u32 unacc_data72 [] = { 0x0041, 0x0061, 0x0041, 0x0061, 0x0041, 0x0061, 0x0041, 0x0061, 0x0041, 0x0061, 0x0041, 0x0061, 0x0041, 0x0061, 0x0041, 0x0061, 0x0041, 0x0061, 0x0041, 0x0061, 0x0041, 0x0061, 0x0041, 0x0061, 0x0045, 0x0065, 0x0045, 0x0065, 0x0045, 0x0065, 0x0045, 0x0065 };
-static u32 unacc_data73 [] = { 0x0045, 0x0065, 0x0045, 0x0065, 0x0045, 0x0065, 0x0045, 0x0065, 0x0049, 0x0069, 0x0049, 0x0069, 0x004F, 0x006F, 0x004F, 0x006F, 0x004F, 0x006F, 0x004F, 0x006F, 0x004F, 0x006F, 0x004F, 0x006F, 0x004F, 0x006F, 0x004F, 0x006F, 0x004F, 0x006F, 0x004F, 0x006F };
-static u32 unacc_data74 [] = { 0x004F, 0x006F, 0x004F, 0x006F, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0059, 0x0079, 0x0059, 0x0079, 0x0059, 0x0079, 0x0059, 0x0079, 0x0000, 0x0000, 0x0000, 0x0000, 0x0059, 0x0079 };
-static u32 unacc_data75 [] = { 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x0391, 0x0391, 0x0391, 0x0391, 0x0391, 0x0391, 0x0391, 0x0391, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x0000, 0x0000, 0x0395, 0x0395, 0x0395, 0x0395, 0x0395, 0x0395, 0x0000, 0x0000 };
-static u32 unacc_data76 [] = { 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x0397, 0x0397, 0x0397, 0x0397, 0x0397, 0x0397, 0x0397, 0x0397, 0x03B9, 0x03B9, 0x03B9, 0x03B9, 0x03B9, 0x03B9, 0x03B9, 0x03B9, 0x0399, 0x0399, 0x0399, 0x0399, 0x0399, 0x0399, 0x0399, 0x0399 };
-static u32 unacc_data77 [] = { 0x03BF, 0x03BF, 0x03BF, 0x03BF, 0x03BF, 0x03BF, 0x0000, 0x0000, 0x039F, 0x039F, 0x039F, 0x039F, 0x039F, 0x039F, 0x0000, 0x0000, 0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x0000, 0x03A5, 0x0000, 0x03A5, 0x0000, 0x03A5, 0x0000, 0x03A5 };
-static u32 unacc_data78 [] = { 0x03C9, 0x03C9, 0x03C9, 0x03C9, 0x03C9, 0x03C9, 0x03C9, 0x03C9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03B1, 0x03B1, 0x03B5, 0x03B5, 0x03B7, 0x03B7, 0x03B9, 0x03B9, 0x03BF, 0x03BF, 0x03C5, 0x03C5, 0x03C9, 0x03C9, 0x0000, 0x0000 };
-static u32 unacc_data79 [] = { 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x0391, 0x0391, 0x0391, 0x0391, 0x0391, 0x0391, 0x0391, 0x0391, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x0397, 0x0397, 0x0397, 0x0397, 0x0397, 0x0397, 0x0397, 0x0397 };
-static u32 unacc_data80 [] = { 0x03C9, 0x03C9, 0x03C9, 0x03C9, 0x03C9, 0x03C9, 0x03C9, 0x03C9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x0000, 0x03B1, 0x03B1, 0x0391, 0x0391, 0x0391, 0x0391, 0x0391, 0x0020, 0x03B9, 0x0020 };
-static u32 unacc_data81 [] = { 0x0020, 0x0020, 0x03B7, 0x03B7, 0x03B7, 0x0000, 0x03B7, 0x03B7, 0x0395, 0x0395, 0x0397, 0x0397, 0x0397, 0x0020, 0x0020, 0x0020, 0x03B9, 0x03B9, 0x03B9, 0x03B9, 0x0000, 0x0000, 0x03B9, 0x03B9, 0x0399, 0x0399, 0x0399, 0x0399, 0x0000, 0x0020, 0x0020, 0x0020 };
-static u32 unacc_data82 [] = { 0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x03C1, 0x03C1, 0x03C5, 0x03C5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A1, 0x0020, 0x0020, 0x0060, 0x0000, 0x0000, 0x03C9, 0x03C9, 0x03C9, 0x0000, 0x03C9, 0x03C9, 0x039F, 0x039F, 0x03A9, 0x03A9, 0x03A9, 0x0020, 0x0020, 0x0000 };
-static u32 unacc_data83 [] = { 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data84 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x002E, 0x002E, 0x002E, 0x002E, 0x002E, 0x002E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x2032, 0x2032, 0x2032, 0x2032, 0x2032, 0x0000, 0x2035, 0x2035, 0x2035, 0x2035,
-                               0x2035, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0021, 0x0000, 0x0020, 0x0000 };
-static u32 unacc_data85 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x005B, 0x005D, 0x003F, 0x003F, 0x003F, 0x0021, 0x0021, 0x003F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2032, 0x2032, 0x2032, 0x2032, 0x0000, 0x0000,
-                               0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020 };
-static u32 unacc_data86 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0030, 0x0069, 0x0000, 0x0000, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x002B, 0x2212, 0x003D, 0x0028, 0x0029, 0x006E };
-static u32 unacc_data87 [] = { 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x002B, 0x2212, 0x003D, 0x0028, 0x0029, 0x0000, 0x0061, 0x0065, 0x006F, 0x0078, 0x0259, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data88 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0052, 0x0073, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data89 [] = { 0x0061, 0x002F, 0x0063, 0x0061, 0x002F, 0x0073, 0x0043, 0x00B0, 0x0043, 0x0000, 0x0063, 0x002F, 0x006F, 0x0063, 0x002F, 0x0075, 0x0190, 0x0000, 0x00B0, 0x0046, 0x0067, 0x0048, 0x0048, 0x0048, 0x0068, 0x0068, 0x0049, 0x0049, 0x004C, 0x006C, 0x0000, 0x004E,
-                               0x004E, 0x006F, 0x0000, 0x0000, 0x0050, 0x0051, 0x0052, 0x0052, 0x0052, 0x0000, 0x0000 };
-static u32 unacc_data90 [] = { 0x0053, 0x004D, 0x0054, 0x0045, 0x004C, 0x0054, 0x004D, 0x0000, 0x005A, 0x0000, 0x03A9, 0x0000, 0x005A, 0x0000, 0x004B, 0x0041, 0x0042, 0x0043, 0x0000, 0x0065, 0x0045, 0x0046, 0x0000, 0x004D, 0x006F, 0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x0069, 0x0000, 0x0046,
-                               0x0041, 0x0058, 0x03C0, 0x03B3, 0x0393, 0x03A0 };
-static u32 unacc_data91 [] = { 0x2211, 0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x0064, 0x0065, 0x0069, 0x006A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0031, 0x002F, 0x0033, 0x0032, 0x002F, 0x0033, 0x0031, 0x002F, 0x0035, 0x0032, 0x002F, 0x0035, 0x0033,
-                               0x002F, 0x0035, 0x0034, 0x002F, 0x0035, 0x0031, 0x002F, 0x0036, 0x0035, 0x002F, 0x0036, 0x0031, 0x002F, 0x0038, 0x0033, 0x002F, 0x0038, 0x0035, 0x002F, 0x0038, 0x0037, 0x002F, 0x0038, 0x0031, 0x002F };
-static u32 unacc_data92 [] = { 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0056, 0x0056, 0x0056, 0x0049, 0x0056, 0x0049, 0x0049, 0x0056, 0x0049, 0x0049, 0x0049, 0x0049, 0x0058, 0x0058, 0x0058, 0x0049, 0x0058, 0x0049, 0x0049, 0x004C, 0x0043, 0x0044, 0x004D, 0x0069, 0x0069,
-                               0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0076, 0x0076, 0x0076, 0x0069, 0x0076, 0x0069, 0x0069, 0x0076, 0x0069, 0x0069, 0x0069, 0x0069, 0x0078, 0x0078, 0x0078, 0x0069, 0x0078, 0x0069, 0x0069, 0x006C, 0x0063, 0x0064, 0x006D };
-static u32 unacc_data93 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2190, 0x2192, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data94 [] = { 0x0000, 0x0000, 0x2190, 0x2192, 0x0000, 0x0000, 0x0000, 0x0000, 0x2195, 0x2190, 0x2192, 0x2190, 0x2192, 0x0000, 0x2194, 0x0000, 0x2191, 0x2191, 0x2193, 0x2193, 0x2192, 0x2193, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data95 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21D0, 0x21D4, 0x21D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2191, 0x2193 };
-static u32 unacc_data96 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21EB, 0x21EB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2190, 0x2192, 0x2194, 0x2190, 0x2192, 0x2194, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data97 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x2203, 0x0000, 0x0000, 0x0000, 0x0000, 0x2208, 0x0000, 0x0000, 0x220B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data98 [] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x2223, 0x0000, 0x2225, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x222B, 0x222B, 0x222B, 0x222B, 0x222B, 0x0000, 0x222E, 0x222E, 0x222E, 0x222E, 0x222E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                               0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data99 [] = { 0x0000, 0x223C, 0x0000, 0x0000, 0x2243, 0x0000, 0x0000, 0x2245, 0x0000, 0x2248, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data100[] = { 0x003D, 0x0000, 0x2261, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x224D, 0x003C, 0x003E, 0x2264, 0x2265, 0x0000, 0x0000, 0x2272, 0x2273, 0x0000, 0x0000, 0x2276, 0x2277, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data101[] = { 0x227A, 0x227B, 0x0000, 0x0000, 0x2282, 0x2283, 0x0000, 0x0000, 0x2286, 0x2287, 0x2282, 0x2283, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data102[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22A2, 0x22A8, 0x22A9, 0x22AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x221F, 0x0000 };
-static u32 unacc_data103[] = { 0x227C, 0x227D, 0x2291, 0x2292, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22B2, 0x22B3, 0x22B4, 0x22B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x2208, 0x2208, 0x220A, 0x2208, 0x2208, 0x220A, 0x2208, 0x2208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data104[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3008, 0x3009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data105[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x221F, 0x0000, 0x0000, 0x007C };
-static u32 unacc_data106[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data107[] = { 0x0000, 0x23C9, 0x23CA, 0x0000, 0x23C9, 0x23CA, 0x0000, 0x23C9, 0x23CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data108[] = { 0x0000, 0x0000, 0x0000, 0x232C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data109[] = { 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x0031, 0x0030, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0033, 0x0031, 0x0034, 0x0031, 0x0035, 0x0031, 0x0036, 0x0031, 0x0037, 0x0031, 0x0038, 0x0031, 0x0039, 0x0032, 0x0030, 0x0028,
-                               0x0031, 0x0029, 0x0028, 0x0032, 0x0029, 0x0028, 0x0033, 0x0029, 0x0028, 0x0034, 0x0029, 0x0028, 0x0035, 0x0029, 0x0028, 0x0036, 0x0029, 0x0028, 0x0037, 0x0029, 0x0028, 0x0038, 0x0029, 0x0028, 0x0039, 0x0029, 0x0028, 0x0031, 0x0030, 0x0029, 0x0028, 0x0031,
-                               0x0031, 0x0029, 0x0028, 0x0031, 0x0032, 0x0029 };
-static u32 unacc_data110[] = { 0x0028, 0x0031, 0x0033, 0x0029, 0x0028, 0x0031, 0x0034, 0x0029, 0x0028, 0x0031, 0x0035, 0x0029, 0x0028, 0x0031, 0x0036, 0x0029, 0x0028, 0x0031, 0x0037, 0x0029, 0x0028, 0x0031, 0x0038, 0x0029, 0x0028, 0x0031, 0x0039, 0x0029, 0x0028, 0x0032, 0x0030, 0x0029,
-                               0x0031, 0x002E, 0x0032, 0x002E, 0x0033, 0x002E, 0x0034, 0x002E, 0x0035, 0x002E, 0x0036, 0x002E, 0x0037, 0x002E, 0x0038, 0x002E, 0x0039, 0x002E, 0x0031, 0x0030, 0x002E, 0x0031, 0x0031, 0x002E, 0x0031, 0x0032, 0x002E, 0x0031, 0x0033, 0x002E, 0x0031, 0x0034,
-                               0x002E, 0x0031, 0x0035, 0x002E, 0x0031, 0x0036, 0x002E, 0x0031, 0x0037, 0x002E, 0x0031, 0x0038, 0x002E, 0x0031, 0x0039, 0x002E, 0x0032, 0x0030, 0x002E, 0x0028, 0x0061, 0x0029, 0x0028, 0x0062, 0x0029, 0x0028, 0x0063, 0x0029, 0x0028, 0x0064, 0x0029 };
-static u32 unacc_data111[] = { 0x0028, 0x0065, 0x0029, 0x0028, 0x0066, 0x0029, 0x0028, 0x0067, 0x0029, 0x0028, 0x0068, 0x0029, 0x0028, 0x0069, 0x0029, 0x0028, 0x006A, 0x0029, 0x0028, 0x006B, 0x0029, 0x0028, 0x006C, 0x0029, 0x0028, 0x006D, 0x0029, 0x0028, 0x006E, 0x0029, 0x0028, 0x006F,
-                               0x0029, 0x0028, 0x0070, 0x0029, 0x0028, 0x0071, 0x0029, 0x0028, 0x0072, 0x0029, 0x0028, 0x0073, 0x0029, 0x0028, 0x0074, 0x0029, 0x0028, 0x0075, 0x0029, 0x0028, 0x0076, 0x0029, 0x0028, 0x0077, 0x0029, 0x0028, 0x0078, 0x0029, 0x0028, 0x0079, 0x0029, 0x0028,
-                               0x007A, 0x0029, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A };
-static u32 unacc_data112[] = { 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070 };
-static u32 unacc_data113[] = { 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data114[] = { 0x0000, 0x0000, 0x25A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data115[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25A1, 0x25B3, 0x0000, 0x0000, 0x0000, 0x25A1, 0x25A1, 0x25A1, 0x25A1, 0x25CB, 0x25CB, 0x25CB, 0x25CB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data116[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2610, 0x2610, 0x0000, 0x2602, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data117[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25CB, 0x25CB, 0x25CF, 0x25CF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data118[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22A5 };
-static u32 unacc_data119[] = { 0x0000, 0x0000, 0x27E1, 0x27E1, 0x25A1, 0x25A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data120[] = { 0x0000, 0x0000, 0x21D0, 0x21D2, 0x21D4, 0x0000, 0x0000, 0x0000, 0x2193, 0x2191, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2192, 0x0000, 0x0000, 0x2192, 0x2192, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data121[] = { 0x0000, 0x0000, 0x0000, 0x2196, 0x2197, 0x2198, 0x2199, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x293A, 0x0000, 0x0000 };
-static u32 unacc_data122[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2192, 0x2190, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data123[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x005B, 0x005D, 0x005B, 0x005D, 0x005B, 0x005D, 0x3008, 0x3009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2220, 0x0000 };
-static u32 unacc_data124[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x2220, 0x29A3, 0x0000, 0x0000, 0x2221, 0x2221, 0x2221, 0x2221, 0x2221, 0x2221, 0x2221, 0x2221, 0x0000, 0x2205, 0x2205, 0x2205, 0x2205, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data125[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22C8, 0x22C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data126[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x29E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25C6, 0x0000, 0x25CB, 0x25CF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x002F, 0x005C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data127[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x222B, 0x222B, 0x222B, 0x222B, 0x0000, 0x222B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x222B, 0x222B, 0x222B, 0x222B, 0x222B, 0x222B,
-                               0x0000, 0x0000, 0x0000 };
-static u32 unacc_data128[] = { 0x0000, 0x0000, 0x002B, 0x002B, 0x002B, 0x002B, 0x002B, 0x002B, 0x002B, 0x2212, 0x2212, 0x2212, 0x2212, 0x0000, 0x0000, 0x0000, 0x00D7, 0x00D7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data129[] = { 0x2229, 0x222A, 0x222A, 0x2229, 0x2229, 0x222A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2227, 0x2228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2227, 0x2228, 0x2227, 0x2228, 0x2227, 0x2227 };
-static u32 unacc_data130[] = { 0x2227, 0x0000, 0x2228, 0x2228, 0x0000, 0x0000, 0x003D, 0x0000, 0x0000, 0x0000, 0x223C, 0x223C, 0x0000, 0x0000, 0x0000, 0x2248, 0x0000, 0x0000, 0x0000, 0x0000, 0x003A, 0x003A, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x0000, 0x0000, 0x0000,
-                               0x0000, 0x0000, 0x0000, 0x0000, 0x2A7D };
-static u32 unacc_data131[] = { 0x2A7E, 0x2A7D, 0x2A7E, 0x2A7D, 0x2A7E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2A95, 0x2A96, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data132[] = { 0x0000, 0x0000, 0x0000, 0x2AA1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x003D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data133[] = { 0x0000, 0x0000, 0x0000, 0x2286, 0x2287, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22D4, 0x0000, 0x2ADD, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data134[] = { 0x0000, 0x27C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2ADF, 0x2AE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2223, 0x007C, 0x007C, 0x22A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data135[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2192, 0x2192, 0x2190, 0x2190, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data136[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2190, 0x2190, 0x2190, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data137[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2C24, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data138[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2C54, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data139[] = { 0x004C, 0x006C, 0x004C, 0x0050, 0x0052, 0x0061, 0x0074, 0x0048, 0x0068, 0x004B, 0x006B, 0x005A, 0x007A, 0x0000, 0x004D, 0x0000, 0x0000, 0x0076, 0x0057, 0x0077, 0x0076, 0x0000, 0x0000, 0x0000, 0x0065, 0x0279, 0x006F, 0x0000, 0x006A, 0x0056, 0x0000, 0x0000 };
-static u32 unacc_data140[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D61, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data141[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2010, 0x007E, 0x0000, 0x0000, 0x007E, 0x007E };
-static u32 unacc_data142[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6BCD };
-static u32 unacc_data143[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9F9F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data144[] = { 0x4E00, 0x4E28, 0x4E36, 0x4E3F, 0x4E59, 0x4E85, 0x4E8C, 0x4EA0, 0x4EBA, 0x513F, 0x5165, 0x516B, 0x5182, 0x5196, 0x51AB, 0x51E0, 0x51F5, 0x5200, 0x529B, 0x52F9, 0x5315, 0x531A, 0x5338, 0x5341, 0x535C, 0x5369, 0x5382, 0x53B6, 0x53C8, 0x53E3, 0x56D7, 0x571F };
-static u32 unacc_data145[] = { 0x58EB, 0x5902, 0x590A, 0x5915, 0x5927, 0x5973, 0x5B50, 0x5B80, 0x5BF8, 0x5C0F, 0x5C22, 0x5C38, 0x5C6E, 0x5C71, 0x5DDB, 0x5DE5, 0x5DF1, 0x5DFE, 0x5E72, 0x5E7A, 0x5E7F, 0x5EF4, 0x5EFE, 0x5F0B, 0x5F13, 0x5F50, 0x5F61, 0x5F73, 0x5FC3, 0x6208, 0x6236, 0x624B };
-static u32 unacc_data146[] = { 0x652F, 0x6534, 0x6587, 0x6597, 0x65A4, 0x65B9, 0x65E0, 0x65E5, 0x66F0, 0x6708, 0x6728, 0x6B20, 0x6B62, 0x6B79, 0x6BB3, 0x6BCB, 0x6BD4, 0x6BDB, 0x6C0F, 0x6C14, 0x6C34, 0x706B, 0x722A, 0x7236, 0x723B, 0x723F, 0x7247, 0x7259, 0x725B, 0x72AC, 0x7384, 0x7389 };
-static u32 unacc_data147[] = { 0x74DC, 0x74E6, 0x7518, 0x751F, 0x7528, 0x7530, 0x758B, 0x7592, 0x7676, 0x767D, 0x76AE, 0x76BF, 0x76EE, 0x77DB, 0x77E2, 0x77F3, 0x793A, 0x79B8, 0x79BE, 0x7A74, 0x7ACB, 0x7AF9, 0x7C73, 0x7CF8, 0x7F36, 0x7F51, 0x7F8A, 0x7FBD, 0x8001, 0x800C, 0x8012, 0x8033 };
-static u32 unacc_data148[] = { 0x807F, 0x8089, 0x81E3, 0x81EA, 0x81F3, 0x81FC, 0x820C, 0x821B, 0x821F, 0x826E, 0x8272, 0x8278, 0x864D, 0x866B, 0x8840, 0x884C, 0x8863, 0x897E, 0x898B, 0x89D2, 0x8A00, 0x8C37, 0x8C46, 0x8C55, 0x8C78, 0x8C9D, 0x8D64, 0x8D70, 0x8DB3, 0x8EAB, 0x8ECA, 0x8F9B };
-static u32 unacc_data149[] = { 0x8FB0, 0x8FB5, 0x9091, 0x9149, 0x91C6, 0x91CC, 0x91D1, 0x9577, 0x9580, 0x961C, 0x96B6, 0x96B9, 0x96E8, 0x9751, 0x975E, 0x9762, 0x9769, 0x97CB, 0x97ED, 0x97F3, 0x9801, 0x98A8, 0x98DB, 0x98DF, 0x9996, 0x9999, 0x99AC, 0x9AA8, 0x9AD8, 0x9ADF, 0x9B25, 0x9B2F };
-static u32 unacc_data150[] = { 0x9B32, 0x9B3C, 0x9B5A, 0x9CE5, 0x9E75, 0x9E7F, 0x9EA5, 0x9EBB, 0x9EC3, 0x9ECD, 0x9ED1, 0x9EF9, 0x9EFD, 0x9F0E, 0x9F13, 0x9F20, 0x9F3B, 0x9F4A, 0x9F52, 0x9F8D, 0x9F9C, 0x9FA0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data151[] = { 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data152[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3012, 0x0000, 0x5341, 0x5344, 0x5345, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data153[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x304B, 0x0000, 0x304D, 0x0000, 0x304F, 0x0000, 0x3051, 0x0000, 0x3053, 0x0000, 0x3055, 0x0000, 0x3057, 0x0000, 0x3059, 0x0000, 0x305B, 0x0000, 0x305D, 0x0000 };
-static u32 unacc_data154[] = { 0x305F, 0x0000, 0x3061, 0x0000, 0x0000, 0x3064, 0x0000, 0x3066, 0x0000, 0x3068, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x306F, 0x306F, 0x0000, 0x3072, 0x3072, 0x0000, 0x3075, 0x3075, 0x0000, 0x3078, 0x3078, 0x0000, 0x307B, 0x307B, 0x0000, 0x0000 };
-static u32 unacc_data155[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3046, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x309D, 0x3088,
-                               0x308A };
-static u32 unacc_data156[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x30AB, 0x0000, 0x30AD, 0x0000, 0x30AF, 0x0000, 0x30B1, 0x0000, 0x30B3, 0x0000, 0x30B5, 0x0000, 0x30B7, 0x0000, 0x30B9, 0x0000, 0x30BB, 0x0000, 0x30BD, 0x0000 };
-static u32 unacc_data157[] = { 0x30BF, 0x0000, 0x30C1, 0x0000, 0x0000, 0x30C4, 0x0000, 0x30C6, 0x0000, 0x30C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x30CF, 0x30CF, 0x0000, 0x30D2, 0x30D2, 0x0000, 0x30D5, 0x30D5, 0x0000, 0x30D8, 0x30D8, 0x0000, 0x30DB, 0x30DB, 0x0000, 0x0000 };
-static u32 unacc_data158[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x30A6, 0x0000, 0x0000, 0x30EF, 0x30F0, 0x30F1, 0x30F2, 0x0000, 0x0000, 0x0000, 0x30FD, 0x30B3,
-                               0x30C8 };
-static u32 unacc_data159[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1100, 0x1101, 0x11AA, 0x1102, 0x11AC, 0x11AD, 0x1103, 0x1104, 0x1105, 0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5 };
-static u32 unacc_data160[] = { 0x111A, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109, 0x110A, 0x110B, 0x110C, 0x110D, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1161, 0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169, 0x116A, 0x116B, 0x116C, 0x116D, 0x116E, 0x116F, 0x1170, 0x1171 };
-static u32 unacc_data161[] = { 0x1172, 0x1173, 0x1174, 0x1175, 0x1160, 0x1114, 0x1115, 0x11C7, 0x11C8, 0x11CC, 0x11CE, 0x11D3, 0x11D7, 0x11D9, 0x111C, 0x11DD, 0x11DF, 0x111D, 0x111E, 0x1120, 0x1122, 0x1123, 0x1127, 0x1129, 0x112B, 0x112C, 0x112D, 0x112E, 0x112F, 0x1132, 0x1136, 0x1140 };
-static u32 unacc_data162[] = { 0x1147, 0x114C, 0x11F1, 0x11F2, 0x1157, 0x1158, 0x1159, 0x1184, 0x1185, 0x1188, 0x1191, 0x1192, 0x1194, 0x119E, 0x11A1, 0x0000, 0x0000, 0x0000, 0x4E00, 0x4E8C, 0x4E09, 0x56DB, 0x4E0A, 0x4E2D, 0x4E0B, 0x7532, 0x4E59, 0x4E19, 0x4E01, 0x5929, 0x5730, 0x4EBA };
-static u32 unacc_data163[] = { 0x0028, 0x1100, 0x0029, 0x0028, 0x1102, 0x0029, 0x0028, 0x1103, 0x0029, 0x0028, 0x1105, 0x0029, 0x0028, 0x1106, 0x0029, 0x0028, 0x1107, 0x0029, 0x0028, 0x1109, 0x0029, 0x0028, 0x110B, 0x0029, 0x0028, 0x110C, 0x0029, 0x0028, 0x110E, 0x0029, 0x0028, 0x110F,
-                               0x0029, 0x0028, 0x1110, 0x0029, 0x0028, 0x1111, 0x0029, 0x0028, 0x1112, 0x0029, 0x0028, 0x1100, 0x1161, 0x0029, 0x0028, 0x1102, 0x1161, 0x0029, 0x0028, 0x1103, 0x1161, 0x0029, 0x0028, 0x1105, 0x1161, 0x0029, 0x0028, 0x1106, 0x1161, 0x0029, 0x0028, 0x1107,
-                               0x1161, 0x0029, 0x0028, 0x1109, 0x1161, 0x0029, 0x0028, 0x110B, 0x1161, 0x0029, 0x0028, 0x110C, 0x1161, 0x0029, 0x0028, 0x110E, 0x1161, 0x0029, 0x0028, 0x110F, 0x1161, 0x0029, 0x0028, 0x1110, 0x1161, 0x0029, 0x0028, 0x1111, 0x1161, 0x0029, 0x0028, 0x1112,
-                               0x1161, 0x0029, 0x0028, 0x110C, 0x116E, 0x0029, 0x0028, 0x110B, 0x1169, 0x110C, 0x1165, 0x11AB, 0x0029, 0x0028, 0x110B, 0x1169, 0x1112, 0x116E, 0x0029, 0x0000 };
-static u32 unacc_data164[] = { 0x0028, 0x4E00, 0x0029, 0x0028, 0x4E8C, 0x0029, 0x0028, 0x4E09, 0x0029, 0x0028, 0x56DB, 0x0029, 0x0028, 0x4E94, 0x0029, 0x0028, 0x516D, 0x0029, 0x0028, 0x4E03, 0x0029, 0x0028, 0x516B, 0x0029, 0x0028, 0x4E5D, 0x0029, 0x0028, 0x5341, 0x0029, 0x0028, 0x6708,
-                               0x0029, 0x0028, 0x706B, 0x0029, 0x0028, 0x6C34, 0x0029, 0x0028, 0x6728, 0x0029, 0x0028, 0x91D1, 0x0029, 0x0028, 0x571F, 0x0029, 0x0028, 0x65E5, 0x0029, 0x0028, 0x682A, 0x0029, 0x0028, 0x6709, 0x0029, 0x0028, 0x793E, 0x0029, 0x0028, 0x540D, 0x0029, 0x0028,
-                               0x7279, 0x0029, 0x0028, 0x8CA1, 0x0029, 0x0028, 0x795D, 0x0029, 0x0028, 0x52B4, 0x0029, 0x0028, 0x4EE3, 0x0029, 0x0028, 0x547C, 0x0029, 0x0028, 0x5B66, 0x0029, 0x0028, 0x76E3, 0x0029, 0x0028, 0x4F01, 0x0029, 0x0028, 0x8CC7, 0x0029, 0x0028, 0x5354, 0x0029 };
-static u32 unacc_data165[] = { 0x0028, 0x796D, 0x0029, 0x0028, 0x4F11, 0x0029, 0x0028, 0x81EA, 0x0029, 0x0028, 0x81F3, 0x0029, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0050, 0x0054, 0x0045, 0x0032, 0x0031, 0x0032, 0x0032, 0x0032,
-                               0x0033, 0x0032, 0x0034, 0x0032, 0x0035, 0x0032, 0x0036, 0x0032, 0x0037, 0x0032, 0x0038, 0x0032, 0x0039, 0x0033, 0x0030, 0x0033, 0x0031, 0x0033, 0x0032, 0x0033, 0x0033, 0x0033, 0x0034, 0x0033, 0x0035 };
-static u32 unacc_data166[] = { 0x1100, 0x1102, 0x1103, 0x1105, 0x1106, 0x1107, 0x1109, 0x110B, 0x110C, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1100, 0x1161, 0x1102, 0x1161, 0x1103, 0x1161, 0x1105, 0x1161, 0x1106, 0x1161, 0x1107, 0x1161, 0x1109, 0x1161, 0x110B, 0x1161, 0x110C, 0x1161,
-                               0x110E, 0x1161, 0x110F, 0x1161, 0x1110, 0x1161, 0x1111, 0x1161, 0x1112, 0x1161, 0x110E, 0x1161, 0x11B7, 0x1100, 0x1169, 0x110C, 0x116E, 0x110B, 0x1174, 0x110B, 0x116E, 0x0000 };
-static u32 unacc_data167[] = { 0x4E00, 0x4E8C, 0x4E09, 0x56DB, 0x4E94, 0x516D, 0x4E03, 0x516B, 0x4E5D, 0x5341, 0x6708, 0x706B, 0x6C34, 0x6728, 0x91D1, 0x571F, 0x65E5, 0x682A, 0x6709, 0x793E, 0x540D, 0x7279, 0x8CA1, 0x795D, 0x52B4, 0x79D8, 0x7537, 0x5973, 0x9069, 0x512A, 0x5370, 0x6CE8 };
-static u32 unacc_data168[] = { 0x9805, 0x4F11, 0x5199, 0x6B63, 0x4E0A, 0x4E2D, 0x4E0B, 0x5DE6, 0x53F3, 0x533B, 0x5B97, 0x5B66, 0x76E3, 0x4F01, 0x8CC7, 0x5354, 0x591C, 0x0033, 0x0036, 0x0033, 0x0037, 0x0033, 0x0038, 0x0033, 0x0039, 0x0034, 0x0030, 0x0034, 0x0031, 0x0034, 0x0032, 0x0034,
-                               0x0033, 0x0034, 0x0034, 0x0034, 0x0035, 0x0034, 0x0036, 0x0034, 0x0037, 0x0034, 0x0038, 0x0034, 0x0039, 0x0035, 0x0030 };
-static u32 unacc_data169[] = { 0x0031, 0x6708, 0x0032, 0x6708, 0x0033, 0x6708, 0x0034, 0x6708, 0x0035, 0x6708, 0x0036, 0x6708, 0x0037, 0x6708, 0x0038, 0x6708, 0x0039, 0x6708, 0x0031, 0x0030, 0x6708, 0x0031, 0x0031, 0x6708, 0x0031, 0x0032, 0x6708, 0x0048, 0x0067, 0x0065, 0x0072, 0x0067,
-                               0x0065, 0x0056, 0x004C, 0x0054, 0x0044, 0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF, 0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD, 0x30BF };
-static u32 unacc_data170[] = { 0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE, 0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EF, 0x30F0, 0x30F1, 0x30F2, 0x0000 };
-static u32 unacc_data171[] = { 0x30A2, 0x30FC, 0x30C8, 0x30CF, 0x30A2, 0x30EB, 0x30D5, 0x30A1, 0x30A2, 0x30F3, 0x30A2, 0x30D8, 0x30A2, 0x30FC, 0x30EB, 0x30A4, 0x30CB, 0x30F3, 0x30AF, 0x30A4, 0x30F3, 0x30C1, 0x30A6, 0x30A9, 0x30F3, 0x30A8, 0x30B9, 0x30AF, 0x30FC, 0x30C8, 0x30A8, 0x30FC,
-                               0x30AB, 0x30FC, 0x30AA, 0x30F3, 0x30B9, 0x30AA, 0x30FC, 0x30E0, 0x30AB, 0x30A4, 0x30EA, 0x30AB, 0x30E9, 0x30C3, 0x30C8, 0x30AB, 0x30ED, 0x30EA, 0x30FC, 0x30ED, 0x30F3, 0x30AB, 0x30F3, 0x30DE, 0x30AB, 0x30AD, 0x30AB, 0x30CB, 0x30FC, 0x30AD, 0x30AD, 0x30E5,
-                               0x30EA, 0x30FC, 0x30EB, 0x30FC, 0x30AD, 0x30BF, 0x30AD, 0x30ED, 0x30AD, 0x30ED, 0x30E9, 0x30E0, 0x30AF, 0x30AD, 0x30ED, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x30AD, 0x30ED, 0x30EF, 0x30C3, 0x30C8, 0x30E9, 0x30E0, 0x30AF, 0x30E9, 0x30E0, 0x30C8, 0x30F3, 0x30AF,
-                               0x30AF, 0x30EB, 0x30A4, 0x30ED, 0x30BB, 0x30AF, 0x30ED, 0x30FC, 0x30CD, 0x30B1, 0x30FC, 0x30B9, 0x30B3, 0x30EB, 0x30CA, 0x30B3, 0x30FC, 0x30DB, 0x30B5, 0x30A4, 0x30AF, 0x30EB };
-static u32 unacc_data172[] = { 0x30B5, 0x30F3, 0x30C1, 0x30FC, 0x30E0, 0x30B7, 0x30EA, 0x30F3, 0x30AF, 0x30BB, 0x30F3, 0x30C1, 0x30BB, 0x30F3, 0x30C8, 0x30FC, 0x30B9, 0x30BF, 0x30B7, 0x30C6, 0x30EB, 0x30C8, 0x30C8, 0x30F3, 0x30CA, 0x30CE, 0x30CE, 0x30C3, 0x30C8, 0x30CF, 0x30A4, 0x30C4,
-                               0x30FC, 0x30BB, 0x30F3, 0x30C8, 0x30CF, 0x30FC, 0x30C4, 0x30CF, 0x30FC, 0x30EC, 0x30EB, 0x30CF, 0x30A2, 0x30B9, 0x30C8, 0x30EB, 0x30D2, 0x30AF, 0x30EB, 0x30D2, 0x30B3, 0x30D2, 0x30EB, 0x30D2, 0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C8, 0x30D5, 0x30A3, 0x30FC,
-                               0x30C8, 0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x30D5, 0x30D5, 0x30E9, 0x30F3, 0x30D8, 0x30AF, 0x30BF, 0x30FC, 0x30EB, 0x30BD, 0x30D8, 0x30CB, 0x30D2, 0x30D8, 0x30D8, 0x30EB, 0x30C4, 0x30F3, 0x30B9, 0x30D8, 0x30FC, 0x30D8, 0x30B7, 0x30FC, 0x30BF, 0x30D8, 0x30A4,
-                               0x30F3, 0x30C8, 0x30DB, 0x30EB, 0x30C8, 0x30DB, 0x30DB, 0x30F3 };
-static u32 unacc_data173[] = { 0x30F3, 0x30DB, 0x30C8, 0x30DB, 0x30FC, 0x30EB, 0x30DB, 0x30FC, 0x30F3, 0x30DE, 0x30A4, 0x30AF, 0x30ED, 0x30DE, 0x30A4, 0x30EB, 0x30DE, 0x30C3, 0x30CF, 0x30DE, 0x30EB, 0x30AF, 0x30DE, 0x30F3, 0x30B7, 0x30E7, 0x30F3, 0x30DF, 0x30AF, 0x30ED, 0x30F3, 0x30DF,
-                               0x30EA, 0x30DF, 0x30EA, 0x30FC, 0x30EB, 0x30CF, 0x30E1, 0x30AB, 0x30E1, 0x30C8, 0x30F3, 0x30AB, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x30E4, 0x30FC, 0x30C8, 0x30E4, 0x30FC, 0x30EB, 0x30E6, 0x30A2, 0x30F3, 0x30EA, 0x30C3, 0x30C8, 0x30EB, 0x30EA, 0x30E9, 0x30EB,
-                               0x30FC, 0x30D2, 0x30EB, 0x30FC, 0x30EB, 0x30D5, 0x30EC, 0x30E0, 0x30EC, 0x30F3, 0x30C8, 0x30F3, 0x30B1, 0x30EF, 0x30C3, 0x30C8, 0x0030, 0x70B9, 0x0031, 0x70B9, 0x0032, 0x70B9, 0x0033, 0x70B9, 0x0034, 0x70B9, 0x0035, 0x70B9, 0x0036, 0x70B9, 0x0037, 0x70B9 };
-static u32 unacc_data174[] = { 0x0038, 0x70B9, 0x0039, 0x70B9, 0x0031, 0x0030, 0x70B9, 0x0031, 0x0031, 0x70B9, 0x0031, 0x0032, 0x70B9, 0x0031, 0x0033, 0x70B9, 0x0031, 0x0034, 0x70B9, 0x0031, 0x0035, 0x70B9, 0x0031, 0x0036, 0x70B9, 0x0031, 0x0037, 0x70B9, 0x0031, 0x0038, 0x70B9, 0x0031,
-                               0x0039, 0x70B9, 0x0032, 0x0030, 0x70B9, 0x0032, 0x0031, 0x70B9, 0x0032, 0x0032, 0x70B9, 0x0032, 0x0033, 0x70B9, 0x0032, 0x0034, 0x70B9, 0x0068, 0x0050, 0x0061, 0x0064, 0x0061, 0x0041, 0x0055, 0x0062, 0x0061, 0x0072, 0x006F, 0x0056, 0x0070, 0x0063, 0x0064,
-                               0x006D, 0x0064, 0x006D, 0x0032, 0x0064, 0x006D, 0x0033, 0x0049, 0x0055, 0x5E73, 0x6210, 0x662D, 0x548C, 0x5927, 0x6B63, 0x660E, 0x6CBB, 0x682A, 0x5F0F, 0x4F1A, 0x793E };
-static u32 unacc_data175[] = { 0x0070, 0x0041, 0x006E, 0x0041, 0x03BC, 0x0041, 0x006D, 0x0041, 0x006B, 0x0041, 0x004B, 0x0042, 0x004D, 0x0042, 0x0047, 0x0042, 0x0063, 0x0061, 0x006C, 0x006B, 0x0063, 0x0061, 0x006C, 0x0070, 0x0046, 0x006E, 0x0046, 0x03BC, 0x0046, 0x03BC, 0x0067, 0x006D,
-                               0x0067, 0x006B, 0x0067, 0x0048, 0x007A, 0x006B, 0x0048, 0x007A, 0x004D, 0x0048, 0x007A, 0x0047, 0x0048, 0x007A, 0x0054, 0x0048, 0x007A, 0x03BC, 0x006C, 0x006D, 0x006C, 0x0064, 0x006C, 0x006B, 0x006C, 0x0066, 0x006D, 0x006E, 0x006D, 0x03BC, 0x006D, 0x006D,
-                               0x006D, 0x0063, 0x006D, 0x006B, 0x006D, 0x006D, 0x006D, 0x0032 };
-static u32 unacc_data176[] = { 0x0063, 0x006D, 0x0032, 0x006D, 0x0032, 0x006B, 0x006D, 0x0032, 0x006D, 0x006D, 0x0033, 0x0063, 0x006D, 0x0033, 0x006D, 0x0033, 0x006B, 0x006D, 0x0033, 0x006D, 0x2215, 0x0073, 0x006D, 0x2215, 0x0073, 0x0032, 0x0050, 0x0061, 0x006B, 0x0050, 0x0061, 0x004D,
-                               0x0050, 0x0061, 0x0047, 0x0050, 0x0061, 0x0072, 0x0061, 0x0064, 0x0072, 0x0061, 0x0064, 0x2215, 0x0073, 0x0072, 0x0061, 0x0064, 0x2215, 0x0073, 0x0032, 0x0070, 0x0073, 0x006E, 0x0073, 0x03BC, 0x0073, 0x006D, 0x0073, 0x0070, 0x0056, 0x006E, 0x0056, 0x03BC,
-                               0x0056, 0x006D, 0x0056, 0x006B, 0x0056, 0x004D, 0x0056, 0x0070, 0x0057, 0x006E, 0x0057, 0x03BC, 0x0057, 0x006D, 0x0057, 0x006B, 0x0057, 0x004D, 0x0057 };
-static u32 unacc_data177[] = { 0x006B, 0x03A9, 0x004D, 0x03A9, 0x0061, 0x002E, 0x006D, 0x002E, 0x0042, 0x0071, 0x0063, 0x0063, 0x0063, 0x0064, 0x0043, 0x2215, 0x006B, 0x0067, 0x0043, 0x006F, 0x002E, 0x0064, 0x0042, 0x0047, 0x0079, 0x0068, 0x0061, 0x0048, 0x0050, 0x0069, 0x006E, 0x004B,
-                               0x004B, 0x004B, 0x004D, 0x006B, 0x0074, 0x006C, 0x006D, 0x006C, 0x006E, 0x006C, 0x006F, 0x0067, 0x006C, 0x0078, 0x006D, 0x0062, 0x006D, 0x0069, 0x006C, 0x006D, 0x006F, 0x006C, 0x0050, 0x0048, 0x0070, 0x002E, 0x006D, 0x002E, 0x0050, 0x0050, 0x004D, 0x0050,
-                               0x0052, 0x0073, 0x0072, 0x0053, 0x0076, 0x0057, 0x0062, 0x0056, 0x2215, 0x006D, 0x0041, 0x2215, 0x006D };
-static u32 unacc_data178[] = { 0x0031, 0x65E5, 0x0032, 0x65E5, 0x0033, 0x65E5, 0x0034, 0x65E5, 0x0035, 0x65E5, 0x0036, 0x65E5, 0x0037, 0x65E5, 0x0038, 0x65E5, 0x0039, 0x65E5, 0x0031, 0x0030, 0x65E5, 0x0031, 0x0031, 0x65E5, 0x0031, 0x0032, 0x65E5, 0x0031, 0x0033, 0x65E5, 0x0031, 0x0034,
-                               0x65E5, 0x0031, 0x0035, 0x65E5, 0x0031, 0x0036, 0x65E5, 0x0031, 0x0037, 0x65E5, 0x0031, 0x0038, 0x65E5, 0x0031, 0x0039, 0x65E5, 0x0032, 0x0030, 0x65E5, 0x0032, 0x0031, 0x65E5, 0x0032, 0x0032, 0x65E5, 0x0032, 0x0033, 0x65E5, 0x0032, 0x0034, 0x65E5, 0x0032,
-                               0x0035, 0x65E5, 0x0032, 0x0036, 0x65E5, 0x0032, 0x0037, 0x65E5, 0x0032, 0x0038, 0x65E5, 0x0032, 0x0039, 0x65E5, 0x0033, 0x0030, 0x65E5, 0x0033, 0x0031, 0x65E5, 0x0067, 0x0061, 0x006C };
-static u32 unacc_data179[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x042B, 0x044B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data180[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0422, 0x0442, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data181[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA72C, 0xA72D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA738, 0xA739, 0x0000, 0x0000, 0x0000, 0x2184 };
-static u32 unacc_data182[] = { 0x004B, 0x006B, 0x004B, 0x006B, 0x004B, 0x006B, 0x0000, 0x0000, 0x004C, 0x006C, 0x004F, 0x006F, 0x004F, 0x006F, 0x0000, 0x0000, 0x0050, 0x0070, 0x0050, 0x0070, 0x0050, 0x0070, 0x0051, 0x0071, 0x0051, 0x0071, 0x0000, 0x0000, 0x0000, 0x0000, 0x0056, 0x0076 };
-static u32 unacc_data183[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x00DE, 0x00FE, 0x00DE, 0x00FE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA76F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data184[] = { 0x8C48, 0x66F4, 0x8ECA, 0x8CC8, 0x6ED1, 0x4E32, 0x53E5, 0x9F9C, 0x9F9C, 0x5951, 0x91D1, 0x5587, 0x5948, 0x61F6, 0x7669, 0x7F85, 0x863F, 0x87BA, 0x88F8, 0x908F, 0x6A02, 0x6D1B, 0x70D9, 0x73DE, 0x843D, 0x916A, 0x99F1, 0x4E82, 0x5375, 0x6B04, 0x721B, 0x862D };
-static u32 unacc_data185[] = { 0x9E1E, 0x5D50, 0x6FEB, 0x85CD, 0x8964, 0x62C9, 0x81D8, 0x881F, 0x5ECA, 0x6717, 0x6D6A, 0x72FC, 0x90CE, 0x4F86, 0x51B7, 0x52DE, 0x64C4, 0x6AD3, 0x7210, 0x76E7, 0x8001, 0x8606, 0x865C, 0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C, 0x797F, 0x7DA0, 0x83C9, 0x9304 };
-static u32 unacc_data186[] = { 0x9E7F, 0x8AD6, 0x58DF, 0x5F04, 0x7C60, 0x807E, 0x7262, 0x78CA, 0x8CC2, 0x96F7, 0x58D8, 0x5C62, 0x6A13, 0x6DDA, 0x6F0F, 0x7D2F, 0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC, 0x7A1C, 0x7DBE, 0x83F1, 0x9675, 0x8B80, 0x62CF, 0x6A02, 0x8AFE, 0x4E39, 0x5BE7 };
-static u32 unacc_data187[] = { 0x6012, 0x7387, 0x7570, 0x5317, 0x78FB, 0x4FBF, 0x5FA9, 0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E, 0x7701, 0x8449, 0x8AAA, 0x6BBA, 0x8FB0, 0x6C88, 0x62FE, 0x82E5, 0x63A0, 0x7565, 0x4EAE, 0x5169, 0x51C9, 0x6881, 0x7CE7, 0x826F, 0x8AD2, 0x91CF, 0x52F5 };
-static u32 unacc_data188[] = { 0x5442, 0x5973, 0x5EEC, 0x65C5, 0x6FFE, 0x792A, 0x95AD, 0x9A6A, 0x9E97, 0x9ECE, 0x529B, 0x66C6, 0x6B77, 0x8F62, 0x5E74, 0x6190, 0x6200, 0x649A, 0x6F23, 0x7149, 0x7489, 0x79CA, 0x7DF4, 0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A, 0x5217, 0x52A3, 0x54BD, 0x70C8 };
-static u32 unacc_data189[] = { 0x88C2, 0x8AAA, 0x5EC9, 0x5FF5, 0x637B, 0x6BAE, 0x7C3E, 0x7375, 0x4EE4, 0x56F9, 0x5BE7, 0x5DBA, 0x601C, 0x73B2, 0x7469, 0x7F9A, 0x8046, 0x9234, 0x96F6, 0x9748, 0x9818, 0x4F8B, 0x79AE, 0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA, 0x5BEE, 0x5C3F, 0x6599, 0x6A02 };
-static u32 unacc_data190[] = { 0x71CE, 0x7642, 0x84FC, 0x907C, 0x9F8D, 0x6688, 0x962E, 0x5289, 0x677B, 0x67F3, 0x6D41, 0x6E9C, 0x7409, 0x7559, 0x786B, 0x7D10, 0x985E, 0x516D, 0x622E, 0x9678, 0x502B, 0x5D19, 0x6DEA, 0x8F2A, 0x5F8B, 0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540F, 0x5C65 };
-static u32 unacc_data191[] = { 0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2, 0x7F79, 0x88CF, 0x88E1, 0x91CC, 0x96E2, 0x533F, 0x6EBA, 0x541D, 0x71D0, 0x7498, 0x85FA, 0x96A3, 0x9C57, 0x9E9F, 0x6797, 0x6DCB, 0x81E8, 0x7ACB, 0x7B20, 0x7C92, 0x72C0, 0x7099, 0x8B58, 0x4EC0, 0x8336, 0x523A };
-static u32 unacc_data192[] = { 0x5207, 0x5EA6, 0x62D3, 0x7CD6, 0x5B85, 0x6D1E, 0x66B4, 0x8F3B, 0x884C, 0x964D, 0x898B, 0x5ED3, 0x5140, 0x55C0, 0x0000, 0x0000, 0x585A, 0x0000, 0x6674, 0x0000, 0x0000, 0x51DE, 0x732A, 0x76CA, 0x793C, 0x795E, 0x7965, 0x798F, 0x9756, 0x7CBE, 0x7FBD, 0x0000 };
-static u32 unacc_data193[] = { 0x8612, 0x0000, 0x8AF8, 0x0000, 0x0000, 0x9038, 0x90FD, 0x0000, 0x0000, 0x0000, 0x98EF, 0x98FC, 0x9928, 0x9DB4, 0x0000, 0x0000, 0x4FAE, 0x50E7, 0x514D, 0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606, 0x5668, 0x5840, 0x58A8, 0x5C64, 0x5C6E, 0x6094, 0x6168, 0x618E };
-static u32 unacc_data194[] = { 0x61F2, 0x654F, 0x65E2, 0x6691, 0x6885, 0x6D77, 0x6E1A, 0x6F22, 0x716E, 0x722B, 0x7422, 0x7891, 0x793E, 0x7949, 0x7948, 0x7950, 0x7956, 0x795D, 0x798D, 0x798E, 0x7A40, 0x7A81, 0x7BC0, 0x7DF4, 0x7E09, 0x7E41, 0x7F72, 0x8005, 0x81ED, 0x8279, 0x8279, 0x8457 };
-static u32 unacc_data195[] = { 0x8910, 0x8996, 0x8B01, 0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x9038, 0x96E3, 0x97FF, 0x983B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E26, 0x51B5, 0x5168, 0x4F80, 0x5145, 0x5180, 0x52C7, 0x52FA, 0x559D, 0x5555, 0x5599, 0x55E2, 0x585A, 0x58B3, 0x5944, 0x5954 };
-static u32 unacc_data196[] = { 0x5A62, 0x5B28, 0x5ED2, 0x5ED9, 0x5F69, 0x5FAD, 0x60D8, 0x614E, 0x6108, 0x618E, 0x6160, 0x61F2, 0x6234, 0x63C4, 0x641C, 0x6452, 0x6556, 0x6674, 0x6717, 0x671B, 0x6756, 0x6B79, 0x6BBA, 0x6D41, 0x6EDB, 0x6ECB, 0x6F22, 0x701E, 0x716E, 0x77A7, 0x7235, 0x72AF };
-static u32 unacc_data197[] = { 0x732A, 0x7471, 0x7506, 0x753B, 0x761D, 0x761F, 0x76CA, 0x76DB, 0x76F4, 0x774A, 0x7740, 0x78CC, 0x7AB1, 0x7BC0, 0x7C7B, 0x7D5B, 0x7DF4, 0x7F3E, 0x8005, 0x8352, 0x83EF, 0x8779, 0x8941, 0x8986, 0x8996, 0x8ABF, 0x8AF8, 0x8ACB, 0x8B01, 0x8AFE, 0x8AED, 0x8B39 };
-// Some data don't fit into a u16 (unsigned short); I switched the table to hold u32 values, doubling its size.
-// An alternative would be to switch back the table to u16 values and change the large values in the next row to 0x0000, as commented below
-static u32 unacc_data198[] = { 0x8B8A, 0x8D08, 0x8F38, 0x9072, 0x9199, 0x9276, 0x967C, 0x96E3, 0x9756, 0x97DB, 0x97FF, 0x980B, 0x983B, 0x9B12, 0x9F9C,0x2284A,0x22844,0x233D5, 0x3B9D, 0x4018, 0x4039,0x25249,0x25CD0,0x27ED3, 0x9F43, 0x9F8E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-// static const u16 unacc_data198[] = { 0x8B8A, 0x8D08, 0x8F38, 0x9072, 0x9199, 0x9276, 0x967C, 0x96E3, 0x9756, 0x97DB, 0x97FF, 0x980B, 0x983B, 0x9B12, 0x9F9C, 0x0000, 0x0000, 0x0000, 0x3B9D, 0x4018, 0x4039, 0x0000, 0x0000, 0x0000, 0x9F43, 0x9F8E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data199[] = { 0x0066, 0x0066, 0x0066, 0x0069, 0x0066, 0x006C, 0x0066, 0x0066, 0x0069, 0x0066, 0x0066, 0x006C, 0x0074, 0x0073, 0x0073, 0x0074, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0574, 0x0576, 0x0574, 0x0565,
-                               0x0574, 0x056B, 0x057E, 0x0576, 0x0574, 0x056D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05D9, 0x0000, 0x05F2 };
-static u32 unacc_data200[] = { 0x05E2, 0x05D0, 0x05D3, 0x05D4, 0x05DB, 0x05DC, 0x05DD, 0x05E8, 0x05EA, 0x002B, 0x05E9, 0x05E9, 0x05E9, 0x05E9, 0x05D0, 0x05D0, 0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x0000, 0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x0000, 0x05DE, 0x0000 };
-static u32 unacc_data201[] = { 0x05E0, 0x05E1, 0x0000, 0x05E3, 0x05E4, 0x0000, 0x05E6, 0x05E7, 0x05E8, 0x05E9, 0x05EA, 0x05D5, 0x05D1, 0x05DB, 0x05E4, 0x05D0, 0x05DC, 0x0671, 0x0671, 0x067B, 0x067B, 0x067B, 0x067B, 0x067E, 0x067E, 0x067E, 0x067E, 0x0680, 0x0680, 0x0680, 0x0680, 0x067A,
-                               0x067A };
-static u32 unacc_data202[] = { 0x067A, 0x067A, 0x067F, 0x067F, 0x067F, 0x067F, 0x0679, 0x0679, 0x0679, 0x0679, 0x06A4, 0x06A4, 0x06A4, 0x06A4, 0x06A6, 0x06A6, 0x06A6, 0x06A6, 0x0684, 0x0684, 0x0684, 0x0684, 0x0683, 0x0683, 0x0683, 0x0683, 0x0686, 0x0686, 0x0686, 0x0686, 0x0687, 0x0687 };
-static u32 unacc_data203[] = { 0x0687, 0x0687, 0x068D, 0x068D, 0x068C, 0x068C, 0x068E, 0x068E, 0x0688, 0x0688, 0x0698, 0x0698, 0x0691, 0x0691, 0x06A9, 0x06A9, 0x06A9, 0x06A9, 0x06AF, 0x06AF, 0x06AF, 0x06AF, 0x06B3, 0x06B3, 0x06B3, 0x06B3, 0x06B1, 0x06B1, 0x06B1, 0x06B1, 0x06BA, 0x06BA };
-static u32 unacc_data204[] = { 0x06BB, 0x06BB, 0x06BB, 0x06BB, 0x06D5, 0x06D5, 0x06C1, 0x06C1, 0x06C1, 0x06C1, 0x06BE, 0x06BE, 0x06BE, 0x06BE, 0x06D2, 0x06D2, 0x06D2, 0x06D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data205[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x06AD, 0x06AD, 0x06AD, 0x06AD, 0x06C7, 0x06C7, 0x06C6, 0x06C6, 0x06C8, 0x06C8, 0x06C7, 0x0674, 0x06CB,
-                               0x06CB };
-static u32 unacc_data206[] = { 0x06C5, 0x06C5, 0x06C9, 0x06C9, 0x06D0, 0x06D0, 0x06D0, 0x06D0, 0x0649, 0x0649, 0x0627, 0x064A, 0x0627, 0x064A, 0x06D5, 0x064A, 0x06D5, 0x064A, 0x0648, 0x064A, 0x0648, 0x064A, 0x06C7, 0x064A, 0x06C7, 0x064A, 0x06C6, 0x064A, 0x06C6, 0x064A, 0x06C8, 0x064A,
-                               0x06C8, 0x064A, 0x06D0, 0x064A, 0x06D0, 0x064A, 0x06D0, 0x064A, 0x0649, 0x064A, 0x0649, 0x064A, 0x0649, 0x064A, 0x06CC, 0x06CC, 0x06CC, 0x06CC };
-static u32 unacc_data207[] = { 0x062C, 0x064A, 0x062D, 0x064A, 0x0645, 0x064A, 0x0649, 0x064A, 0x064A, 0x064A, 0x0628, 0x062C, 0x0628, 0x062D, 0x0628, 0x062E, 0x0628, 0x0645, 0x0628, 0x0649, 0x0628, 0x064A, 0x062A, 0x062C, 0x062A, 0x062D, 0x062A, 0x062E, 0x062A, 0x0645, 0x062A, 0x0649,
-                               0x062A, 0x064A, 0x062B, 0x062C, 0x062B, 0x0645, 0x062B, 0x0649, 0x062B, 0x064A, 0x062C, 0x062D, 0x062C, 0x0645, 0x062D, 0x062C, 0x062D, 0x0645, 0x062E, 0x062C, 0x062E, 0x062D, 0x062E, 0x0645, 0x0633, 0x062C, 0x0633, 0x062D, 0x0633, 0x062E, 0x0633, 0x0645 };
-static u32 unacc_data208[] = { 0x0635, 0x062D, 0x0635, 0x0645, 0x0636, 0x062C, 0x0636, 0x062D, 0x0636, 0x062E, 0x0636, 0x0645, 0x0637, 0x062D, 0x0637, 0x0645, 0x0638, 0x0645, 0x0639, 0x062C, 0x0639, 0x0645, 0x063A, 0x062C, 0x063A, 0x0645, 0x0641, 0x062C, 0x0641, 0x062D, 0x0641, 0x062E,
-                               0x0641, 0x0645, 0x0641, 0x0649, 0x0641, 0x064A, 0x0642, 0x062D, 0x0642, 0x0645, 0x0642, 0x0649, 0x0642, 0x064A, 0x0643, 0x0627, 0x0643, 0x062C, 0x0643, 0x062D, 0x0643, 0x062E, 0x0643, 0x0644, 0x0643, 0x0645, 0x0643, 0x0649, 0x0643, 0x064A, 0x0644, 0x062C };
-static u32 unacc_data209[] = { 0x0644, 0x062D, 0x0644, 0x062E, 0x0644, 0x0645, 0x0644, 0x0649, 0x0644, 0x064A, 0x0645, 0x062C, 0x0645, 0x062D, 0x0645, 0x062E, 0x0645, 0x0645, 0x0645, 0x0649, 0x0645, 0x064A, 0x0646, 0x062C, 0x0646, 0x062D, 0x0646, 0x062E, 0x0646, 0x0645, 0x0646, 0x0649,
-                               0x0646, 0x064A, 0x0647, 0x062C, 0x0647, 0x0645, 0x0647, 0x0649, 0x0647, 0x064A, 0x064A, 0x062C, 0x064A, 0x062D, 0x064A, 0x062E, 0x064A, 0x0645, 0x064A, 0x0649, 0x064A, 0x064A, 0x0630, 0x0631, 0x0649, 0x0020, 0x0020 };
-static u32 unacc_data210[] = { 0x0020, 0x0020, 0x0020, 0x0020, 0x0631, 0x064A, 0x0632, 0x064A, 0x0645, 0x064A, 0x0646, 0x064A, 0x0649, 0x064A, 0x064A, 0x064A, 0x0628, 0x0631, 0x0628, 0x0632, 0x0628, 0x0645, 0x0628, 0x0646, 0x0628, 0x0649, 0x0628, 0x064A, 0x062A, 0x0631, 0x062A, 0x0632,
-                               0x062A, 0x0645, 0x062A, 0x0646, 0x062A, 0x0649, 0x062A, 0x064A, 0x062B, 0x0631, 0x062B, 0x0632, 0x062B, 0x0645, 0x062B, 0x0646, 0x062B, 0x0649, 0x062B, 0x064A, 0x0641, 0x0649, 0x0641, 0x064A, 0x0642, 0x0649, 0x0642, 0x064A };
-static u32 unacc_data211[] = { 0x0643, 0x0627, 0x0643, 0x0644, 0x0643, 0x0645, 0x0643, 0x0649, 0x0643, 0x064A, 0x0644, 0x0645, 0x0644, 0x0649, 0x0644, 0x064A, 0x0645, 0x0627, 0x0645, 0x0645, 0x0646, 0x0631, 0x0646, 0x0632, 0x0646, 0x0645, 0x0646, 0x0646, 0x0646, 0x0649, 0x0646, 0x064A,
-                               0x0649, 0x064A, 0x0631, 0x064A, 0x0632, 0x064A, 0x0645, 0x064A, 0x0646, 0x064A, 0x0649, 0x064A, 0x064A, 0x062C, 0x064A, 0x062D, 0x064A, 0x062E, 0x064A, 0x0645, 0x064A, 0x0647, 0x064A, 0x0628, 0x062C, 0x0628, 0x062D, 0x0628, 0x062E, 0x0628, 0x0645 };
-static u32 unacc_data212[] = { 0x0628, 0x0647, 0x062A, 0x062C, 0x062A, 0x062D, 0x062A, 0x062E, 0x062A, 0x0645, 0x062A, 0x0647, 0x062B, 0x0645, 0x062C, 0x062D, 0x062C, 0x0645, 0x062D, 0x062C, 0x062D, 0x0645, 0x062E, 0x062C, 0x062E, 0x0645, 0x0633, 0x062C, 0x0633, 0x062D, 0x0633, 0x062E,
-                               0x0633, 0x0645, 0x0635, 0x062D, 0x0635, 0x062E, 0x0635, 0x0645, 0x0636, 0x062C, 0x0636, 0x062D, 0x0636, 0x062E, 0x0636, 0x0645, 0x0637, 0x062D, 0x0638, 0x0645, 0x0639, 0x062C, 0x0639, 0x0645, 0x063A, 0x062C, 0x063A, 0x0645, 0x0641, 0x062C, 0x0641, 0x062D };
-static u32 unacc_data213[] = { 0x0641, 0x062E, 0x0641, 0x0645, 0x0642, 0x062D, 0x0642, 0x0645, 0x0643, 0x062C, 0x0643, 0x062D, 0x0643, 0x062E, 0x0643, 0x0644, 0x0643, 0x0645, 0x0644, 0x062C, 0x0644, 0x062D, 0x0644, 0x062E, 0x0644, 0x0645, 0x0644, 0x0647, 0x0645, 0x062C, 0x0645, 0x062D,
-                               0x0645, 0x062E, 0x0645, 0x0645, 0x0646, 0x062C, 0x0646, 0x062D, 0x0646, 0x062E, 0x0646, 0x0645, 0x0646, 0x0647, 0x0647, 0x062C, 0x0647, 0x0645, 0x0647, 0x064A, 0x062C, 0x064A, 0x062D, 0x064A, 0x062E, 0x064A, 0x0645, 0x064A, 0x0647, 0x0645, 0x064A };
-static u32 unacc_data214[] = { 0x0647, 0x064A, 0x0628, 0x0645, 0x0628, 0x0647, 0x062A, 0x0645, 0x062A, 0x0647, 0x062B, 0x0645, 0x062B, 0x0647, 0x0633, 0x0645, 0x0633, 0x0647, 0x0634, 0x0645, 0x0634, 0x0647, 0x0643, 0x0644, 0x0643, 0x0645, 0x0644, 0x0645, 0x0646, 0x0645, 0x0646, 0x0647,
-                               0x064A, 0x0645, 0x064A, 0x0647, 0x0640, 0x0640, 0x0640, 0x0637, 0x0649, 0x0637, 0x064A, 0x0639, 0x0649, 0x0639, 0x064A, 0x063A, 0x0649, 0x063A, 0x064A, 0x0633, 0x0649, 0x0633, 0x064A, 0x0634, 0x0649, 0x0634, 0x064A, 0x062D, 0x0649 };
-static u32 unacc_data215[] = { 0x062D, 0x064A, 0x062C, 0x0649, 0x062C, 0x064A, 0x062E, 0x0649, 0x062E, 0x064A, 0x0635, 0x0649, 0x0635, 0x064A, 0x0636, 0x0649, 0x0636, 0x064A, 0x0634, 0x062C, 0x0634, 0x062D, 0x0634, 0x062E, 0x0634, 0x0645, 0x0634, 0x0631, 0x0633, 0x0631, 0x0635, 0x0631,
-                               0x0636, 0x0631, 0x0637, 0x0649, 0x0637, 0x064A, 0x0639, 0x0649, 0x0639, 0x064A, 0x063A, 0x0649, 0x063A, 0x064A, 0x0633, 0x0649, 0x0633, 0x064A, 0x0634, 0x0649, 0x0634, 0x064A, 0x062D, 0x0649, 0x062D, 0x064A, 0x062C, 0x0649, 0x062C, 0x064A, 0x062E, 0x0649 };
-static u32 unacc_data216[] = { 0x062E, 0x064A, 0x0635, 0x0649, 0x0635, 0x064A, 0x0636, 0x0649, 0x0636, 0x064A, 0x0634, 0x062C, 0x0634, 0x062D, 0x0634, 0x062E, 0x0634, 0x0645, 0x0634, 0x0631, 0x0633, 0x0631, 0x0635, 0x0631, 0x0636, 0x0631, 0x0634, 0x062C, 0x0634, 0x062D, 0x0634, 0x062E,
-                               0x0634, 0x0645, 0x0633, 0x0647, 0x0634, 0x0647, 0x0637, 0x0645, 0x0633, 0x062C, 0x0633, 0x062D, 0x0633, 0x062E, 0x0634, 0x062C, 0x0634, 0x062D, 0x0634, 0x062E, 0x0637, 0x0645, 0x0638, 0x0645, 0x0627, 0x0627, 0x0000, 0x0000 };
-static u32 unacc_data217[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x062A, 0x062C, 0x0645, 0x062A, 0x062D, 0x062C, 0x062A, 0x062D, 0x062C, 0x062A, 0x062D, 0x0645, 0x062A, 0x062E, 0x0645, 0x062A,
-                               0x0645, 0x062C, 0x062A, 0x0645, 0x062D, 0x062A, 0x0645, 0x062E, 0x062C, 0x0645, 0x062D, 0x062C, 0x0645, 0x062D, 0x062D, 0x0645, 0x064A, 0x062D, 0x0645, 0x0649, 0x0633, 0x062D, 0x062C, 0x0633, 0x062C, 0x062D, 0x0633, 0x062C, 0x0649, 0x0633, 0x0645, 0x062D };
-static u32 unacc_data218[] = { 0x0633, 0x0645, 0x062D, 0x0633, 0x0645, 0x062C, 0x0633, 0x0645, 0x0645, 0x0633, 0x0645, 0x0645, 0x0635, 0x062D, 0x062D, 0x0635, 0x062D, 0x062D, 0x0635, 0x0645, 0x0645, 0x0634, 0x062D, 0x0645, 0x0634, 0x062D, 0x0645, 0x0634, 0x062C, 0x064A, 0x0634, 0x0645,
-                               0x062E, 0x0634, 0x0645, 0x062E, 0x0634, 0x0645, 0x0645, 0x0634, 0x0645, 0x0645, 0x0636, 0x062D, 0x0649, 0x0636, 0x062E, 0x0645, 0x0636, 0x062E, 0x0645, 0x0637, 0x0645, 0x062D, 0x0637, 0x0645, 0x062D, 0x0637, 0x0645, 0x0645, 0x0637, 0x0645, 0x064A, 0x0639,
-                               0x062C, 0x0645, 0x0639, 0x0645, 0x0645, 0x0639, 0x0645, 0x0645, 0x0639, 0x0645, 0x0649, 0x063A, 0x0645, 0x0645, 0x063A, 0x0645, 0x064A, 0x063A, 0x0645, 0x0649, 0x0641, 0x062E, 0x0645, 0x0641, 0x062E, 0x0645, 0x0642, 0x0645, 0x062D, 0x0642, 0x0645, 0x0645 };
-static u32 unacc_data219[] = { 0x0644, 0x062D, 0x0645, 0x0644, 0x062D, 0x064A, 0x0644, 0x062D, 0x0649, 0x0644, 0x062C, 0x062C, 0x0644, 0x062C, 0x062C, 0x0644, 0x062E, 0x0645, 0x0644, 0x062E, 0x0645, 0x0644, 0x0645, 0x062D, 0x0644, 0x0645, 0x062D, 0x0645, 0x062D, 0x062C, 0x0645, 0x062D,
-                               0x0645, 0x0645, 0x062D, 0x064A, 0x0645, 0x062C, 0x062D, 0x0645, 0x062C, 0x0645, 0x0645, 0x062E, 0x062C, 0x0645, 0x062E, 0x0645, 0x0000, 0x0000, 0x0645, 0x062C, 0x062E, 0x0647, 0x0645, 0x062C, 0x0647, 0x0645, 0x0645, 0x0646, 0x062D, 0x0645, 0x0646, 0x062D,
-                               0x0649, 0x0646, 0x062C, 0x0645, 0x0646, 0x062C, 0x0645, 0x0646, 0x062C, 0x0649, 0x0646, 0x0645, 0x064A, 0x0646, 0x0645, 0x0649, 0x064A, 0x0645, 0x0645, 0x064A, 0x0645, 0x0645, 0x0628, 0x062E, 0x064A, 0x062A, 0x062C, 0x064A };
-static u32 unacc_data220[] = { 0x062A, 0x062C, 0x0649, 0x062A, 0x062E, 0x064A, 0x062A, 0x062E, 0x0649, 0x062A, 0x0645, 0x064A, 0x062A, 0x0645, 0x0649, 0x062C, 0x0645, 0x064A, 0x062C, 0x062D, 0x0649, 0x062C, 0x0645, 0x0649, 0x0633, 0x062E, 0x0649, 0x0635, 0x062D, 0x064A, 0x0634, 0x062D,
-                               0x064A, 0x0636, 0x062D, 0x064A, 0x0644, 0x062C, 0x064A, 0x0644, 0x0645, 0x064A, 0x064A, 0x062D, 0x064A, 0x064A, 0x062C, 0x064A, 0x064A, 0x0645, 0x064A, 0x0645, 0x0645, 0x064A, 0x0642, 0x0645, 0x064A, 0x0646, 0x062D, 0x064A, 0x0642, 0x0645, 0x062D, 0x0644,
-                               0x062D, 0x0645, 0x0639, 0x0645, 0x064A, 0x0643, 0x0645, 0x064A, 0x0646, 0x062C, 0x062D, 0x0645, 0x062E, 0x064A, 0x0644, 0x062C, 0x0645, 0x0643, 0x0645, 0x0645, 0x0644, 0x062C, 0x0645, 0x0646, 0x062C, 0x062D, 0x062C, 0x062D, 0x064A, 0x062D, 0x062C, 0x064A };
-static u32 unacc_data221[] = { 0x0645, 0x062C, 0x064A, 0x0641, 0x0645, 0x064A, 0x0628, 0x062D, 0x064A, 0x0643, 0x0645, 0x0645, 0x0639, 0x062C, 0x0645, 0x0635, 0x0645, 0x0645, 0x0633, 0x062E, 0x064A, 0x0646, 0x062C, 0x064A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                               0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data222[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0635, 0x0644, 0x06D2, 0x0642, 0x0644, 0x06D2, 0x0627, 0x0644, 0x0644, 0x0647, 0x0627, 0x0643, 0x0628, 0x0631, 0x0645, 0x062D,
-                               0x0645, 0x062F, 0x0635, 0x0644, 0x0639, 0x0645, 0x0631, 0x0633, 0x0648, 0x0644, 0x0639, 0x0644, 0x064A, 0x0647, 0x0648, 0x0633, 0x0644, 0x0645, 0x0635, 0x0644, 0x0649, 0x0635, 0x0644, 0x0649, 0x0020, 0x0627, 0x0644, 0x0644, 0x0647, 0x0020, 0x0639, 0x0644,
-                               0x064A, 0x0647, 0x0020, 0x0648, 0x0633, 0x0644, 0x0645, 0x062C, 0x0644, 0x0020, 0x062C, 0x0644, 0x0627, 0x0644, 0x0647, 0x0631, 0x06CC, 0x0627, 0x0644, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data223[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x002C, 0x3001, 0x3002, 0x003A, 0x003B, 0x0021, 0x003F, 0x3016, 0x3017, 0x002E, 0x002E, 0x002E, 0x0000, 0x0000, 0x0000, 0x0000,
-                               0x0000, 0x0000 };
-static u32 unacc_data224[] = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x002E, 0x002E, 0x2014, 0x2013, 0x005F, 0x005F, 0x0028, 0x0029, 0x007B, 0x007D, 0x3014, 0x3015, 0x3010, 0x3011, 0x300A, 0x300B,
-                               0x3008 };
-static u32 unacc_data225[] = { 0x3009, 0x300C, 0x300D, 0x300E, 0x300F, 0x0000, 0x0000, 0x005B, 0x005D, 0x0020, 0x0020, 0x0020, 0x0020, 0x005F, 0x005F, 0x005F, 0x002C, 0x3001, 0x002E, 0x0000, 0x003B, 0x003A, 0x003F, 0x0021, 0x2014, 0x0028, 0x0029, 0x007B, 0x007D, 0x3014, 0x3015, 0x0023 };
-static u32 unacc_data226[] = { 0x0026, 0x002A, 0x002B, 0x002D, 0x003C, 0x003E, 0x003D, 0x0000, 0x005C, 0x0024, 0x0025, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0640, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0640, 0x0020, 0x0640, 0x0020, 0x0640, 0x0020, 0x0640, 0x0020, 0x0640 };
-static u32 unacc_data227[] = { 0x0621, 0x0627, 0x0627, 0x0627, 0x0627, 0x0648, 0x0648, 0x0627, 0x0627, 0x064A, 0x064A, 0x064A, 0x064A, 0x0627, 0x0627, 0x0628, 0x0628, 0x0628, 0x0628, 0x0629, 0x0629, 0x062A, 0x062A, 0x062A, 0x062A, 0x062B, 0x062B, 0x062B, 0x062B, 0x062C, 0x062C, 0x062C };
-static u32 unacc_data228[] = { 0x062C, 0x062D, 0x062D, 0x062D, 0x062D, 0x062E, 0x062E, 0x062E, 0x062E, 0x062F, 0x062F, 0x0630, 0x0630, 0x0631, 0x0631, 0x0632, 0x0632, 0x0633, 0x0633, 0x0633, 0x0633, 0x0634, 0x0634, 0x0634, 0x0634, 0x0635, 0x0635, 0x0635, 0x0635, 0x0636, 0x0636, 0x0636 };
-static u32 unacc_data229[] = { 0x0636, 0x0637, 0x0637, 0x0637, 0x0637, 0x0638, 0x0638, 0x0638, 0x0638, 0x0639, 0x0639, 0x0639, 0x0639, 0x063A, 0x063A, 0x063A, 0x063A, 0x0641, 0x0641, 0x0641, 0x0641, 0x0642, 0x0642, 0x0642, 0x0642, 0x0643, 0x0643, 0x0643, 0x0643, 0x0644, 0x0644, 0x0644 };
-static u32 unacc_data230[] = { 0x0644, 0x0645, 0x0645, 0x0645, 0x0645, 0x0646, 0x0646, 0x0646, 0x0646, 0x0647, 0x0647, 0x0647, 0x0647, 0x0648, 0x0648, 0x0649, 0x0649, 0x064A, 0x064A, 0x064A, 0x064A, 0x0644, 0x0627, 0x0644, 0x0627, 0x0644, 0x0627, 0x0644, 0x0627, 0x0644, 0x0627, 0x0644,
-                               0x0627, 0x0644, 0x0627, 0x0644, 0x0627, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data231[] = { 0x0000, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F };
-static u32 unacc_data232[] = { 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F };
-static u32 unacc_data233[] = { 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2985 };
-static u32 unacc_data234[] = { 0x2986, 0x3002, 0x300C, 0x300D, 0x3001, 0x30FB, 0x30F2, 0x30A1, 0x30A3, 0x30A5, 0x30A7, 0x30A9, 0x30E3, 0x30E5, 0x30E7, 0x30C3, 0x30FC, 0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF, 0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD };
-static u32 unacc_data235[] = { 0x30BF, 0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE, 0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EF, 0x30F3, 0x0000, 0x0000 };
-static u32 unacc_data236[] = { 0x1160, 0x1100, 0x1101, 0x11AA, 0x1102, 0x11AC, 0x11AD, 0x1103, 0x1104, 0x1105, 0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5, 0x111A, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109, 0x110A, 0x110B, 0x110C, 0x110D, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x0000 };
-static u32 unacc_data237[] = { 0x0000, 0x0000, 0x1161, 0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x0000, 0x0000, 0x1167, 0x1168, 0x1169, 0x116A, 0x116B, 0x116C, 0x0000, 0x0000, 0x116D, 0x116E, 0x116F, 0x1170, 0x1171, 0x1172, 0x0000, 0x0000, 0x1173, 0x1174, 0x1175, 0x0000, 0x0000, 0x0000 };
-static u32 unacc_data238[] = { 0x00A2, 0x00A3, 0x00AC, 0x0020, 0x00A6, 0x00A5, 0x20A9, 0x0000, 0x2502, 0x2190, 0x2191, 0x2192, 0x2193, 0x25A0, 0x25CB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-
-// This table has been modified to take care of full width characters
-static const u32 *unacc_data_table[UNACC_BLOCK_COUNT] = {
-unacc_data0,unacc_data1,unacc_data2,unacc_data3,unacc_data4,unacc_data5,unacc_data6,unacc_data7,unacc_data8,unacc_data9,
-unacc_data10,unacc_data11,unacc_data12,unacc_data13,unacc_data14,unacc_data15,unacc_data16,unacc_data17,unacc_data18,unacc_data19,
-unacc_data20,unacc_data21,unacc_data22,unacc_data23,unacc_data24,unacc_data25,unacc_data26,unacc_data27,unacc_data28,unacc_data29,
-unacc_data30,unacc_data31,unacc_data32,unacc_data33,unacc_data34,unacc_data35,unacc_data36,unacc_data37,unacc_data38,unacc_data39,
-unacc_data40,unacc_data41,unacc_data42,unacc_data43,unacc_data44,unacc_data45,unacc_data46,unacc_data47,unacc_data48,unacc_data49,
-unacc_data50,unacc_data51,unacc_data52,unacc_data53,unacc_data54,unacc_data55,unacc_data56,unacc_data57,unacc_data58,unacc_data59,
-unacc_data60,unacc_data61,unacc_data62,unacc_data63,unacc_data64,unacc_data65,unacc_data66,unacc_data67,unacc_data68,unacc_data69,
-unacc_data70,unacc_data71,unacc_data72,unacc_data73,unacc_data74,unacc_data75,unacc_data76,unacc_data77,unacc_data78,unacc_data79,
-unacc_data80,unacc_data81,unacc_data82,unacc_data83,unacc_data84,unacc_data85,unacc_data86,unacc_data87,unacc_data88,unacc_data89,
-unacc_data90,unacc_data91,unacc_data92,unacc_data93,unacc_data94,unacc_data95,unacc_data96,unacc_data97,unacc_data98,unacc_data99,
-unacc_data100,unacc_data101,unacc_data102,unacc_data103,unacc_data104,unacc_data105,unacc_data106,unacc_data107,unacc_data108,unacc_data109,
-unacc_data110,unacc_data111,unacc_data112,unacc_data113,unacc_data114,unacc_data115,unacc_data116,unacc_data117,unacc_data118,unacc_data119,
-unacc_data120,unacc_data121,unacc_data122,unacc_data123,unacc_data124,unacc_data125,unacc_data126,unacc_data127,unacc_data128,unacc_data129,
-unacc_data130,unacc_data131,unacc_data132,unacc_data133,unacc_data134,unacc_data135,unacc_data136,unacc_data137,unacc_data138,unacc_data139,
-unacc_data140,unacc_data141,unacc_data142,unacc_data143,unacc_data144,unacc_data145,unacc_data146,unacc_data147,unacc_data148,unacc_data149,
-unacc_data150,unacc_data151,unacc_data152,unacc_data153,unacc_data154,unacc_data155,unacc_data156,unacc_data157,unacc_data158,unacc_data159,
-unacc_data160,unacc_data161,unacc_data162,unacc_data163,unacc_data164,unacc_data165,unacc_data166,unacc_data167,unacc_data168,unacc_data169,
-unacc_data170,unacc_data171,unacc_data172,unacc_data173,unacc_data174,unacc_data175,unacc_data176,unacc_data177,unacc_data178,unacc_data179,
-unacc_data180,unacc_data181,unacc_data182,unacc_data183,unacc_data184,unacc_data185,unacc_data186,unacc_data187,unacc_data188,unacc_data189,
-unacc_data190,unacc_data191,unacc_data192,unacc_data193,unacc_data194,unacc_data195,unacc_data196,unacc_data197,unacc_data198,unacc_data199,
-unacc_data200,unacc_data201,unacc_data202,unacc_data203,unacc_data204,unacc_data205,unacc_data206,unacc_data207,unacc_data208,unacc_data209,
-unacc_data210,unacc_data211,unacc_data212,unacc_data213,unacc_data214,unacc_data215,unacc_data216,unacc_data217,unacc_data218,unacc_data219,
-unacc_data220,unacc_data221,unacc_data222,unacc_data223,unacc_data224,unacc_data225,unacc_data226,unacc_data227,unacc_data228,unacc_data229,
-unacc_data230,unacc_data231,unacc_data232,unacc_data233,unacc_data234,unacc_data235,unacc_data236,unacc_data237,unacc_data238
-};
-/* Generated by builder. Do not modify. End unacc_tables */
+SQLITE_PRIVATE u32 unifuzz_fold(
+    u32 c
+){
+    return PROPS_MAP(c, unifuzz_props(c, 0)->fold);
+}
 
 
 SQLITE_PRIVATE u32 unifuzz_unacc(
     u32 c,
-    u32 **p,
+    const u16 **p,
     int *l
 ){
-    if (c < 0x10000) {
-        u16 pos, index;
-        index = unacc_indexes[c >> UNACC_BLOCK_SHIFT];
-        pos = c & UNACC_BLOCK_MASK;
-        *p = (u32 *) &(unacc_data_table[index][unacc_positions[index][pos]]);
-        *l = ((**p == 0) ? 0 : unacc_positions[index][pos + 1] - unacc_positions[index][pos]);
-    } else {
-        *l = 0;
-    }
+    u16 base;
+    const CodePropsT *pProps = unifuzz_props(c, &base);
+    *p = PROPS_UNACC(base, pProps->unacc);
+    *l = pProps->unaccLength;
     return c;
 }
 
 
+/*
+** unifuzz_unacc(unifuzz_fold(c)) in a single lookup
+*/
 SQLITE_PRIVATE u32 unifuzz_fold_unacc(
     u32 c,
-    u32 **p,
+    const u16 **p,
     int *l
 ){
-    if (c < 0x10000) {
-        u16 pos, index;
-        pos = fold_data_table[fold_indexes[c >> FOLD_BLOCK_SHIFT]][c & FOLD_BLOCK_MASK];
-        c = (u32) ((pos == 0) ? c : pos);
-        index = unacc_indexes[c >> UNACC_BLOCK_SHIFT];
-        pos = c & UNACC_BLOCK_MASK;
-        *p = (u32 *) &(unacc_data_table[index][unacc_positions[index][pos]]);
-        *l = ((**p == 0) ? 0 : unacc_positions[index][pos + 1] - unacc_positions[index][pos]);
-    } else {
-        *l = 0;
-    }
-    return c;
+    u16 base;
+    const CodePropsT *pProps = unifuzz_props(c, &base);
+    *p = PROPS_UNACC(base, pProps->foldUnacc);
+    *l = pProps->foldUnaccLength;
+    return PROPS_MAP(c, pProps->fold);
 }
 
 
-/* Generated by builder. Do not modify. Start lower_defines */
-#define LOWER_BLOCK_SHIFT 6
-#define LOWER_BLOCK_MASK ((1 << LOWER_BLOCK_SHIFT) - 1)
-#define LOWER_BLOCK_SIZE (1 << LOWER_BLOCK_SHIFT)
-#define LOWER_BLOCK_COUNT 43
-#define LOWER_INDEXES_SIZE (0x10000 >> LOWER_BLOCK_SHIFT)
-/* Generated by builder. Do not modify. End lower_defines */
-
-/*  JCD lower  */
-static const u16 lower_indexes[LOWER_INDEXES_SIZE] = {
-   0,   1,   0,   2,   3,   4,   5,   6,   7,   8,   0,   0,   0,   9,  10,
-  11,  12,  13,  14,  15,  16,  17,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,  18,  19,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  20,  21,  22,  23,  24,  25,  26,  27,   0,   0,   0,   0,  28,  29,  30,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  31,  32,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  33,  34,  35,  36,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,  37,  38,   0,  39,  40,  41,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  42,   0,   0
-};
-
-static const u16 lower_data0[]   = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data1[]   = { 0x0000, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
-                                     0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data2[]   = { 0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
-                                     0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x0000, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data3[]   = { 0x0101, 0x0000, 0x0103, 0x0000, 0x0105, 0x0000, 0x0107, 0x0000, 0x0109, 0x0000, 0x010B, 0x0000, 0x010D, 0x0000, 0x010F, 0x0000,
-                                     0x0111, 0x0000, 0x0113, 0x0000, 0x0115, 0x0000, 0x0117, 0x0000, 0x0119, 0x0000, 0x011B, 0x0000, 0x011D, 0x0000, 0x011F, 0x0000,
-                                     0x0121, 0x0000, 0x0123, 0x0000, 0x0125, 0x0000, 0x0127, 0x0000, 0x0129, 0x0000, 0x012B, 0x0000, 0x012D, 0x0000, 0x012F, 0x0000,
-                                     0x0069, 0x0000, 0x0133, 0x0000, 0x0135, 0x0000, 0x0137, 0x0000, 0x0000, 0x013A, 0x0000, 0x013C, 0x0000, 0x013E, 0x0000, 0x0140 };
-static const u16 lower_data4[]   = { 0x0000, 0x0142, 0x0000, 0x0144, 0x0000, 0x0146, 0x0000, 0x0148, 0x0000, 0x0000, 0x014B, 0x0000, 0x014D, 0x0000, 0x014F, 0x0000,
-                                     0x0151, 0x0000, 0x0153, 0x0000, 0x0155, 0x0000, 0x0157, 0x0000, 0x0159, 0x0000, 0x015B, 0x0000, 0x015D, 0x0000, 0x015F, 0x0000,
-                                     0x0161, 0x0000, 0x0163, 0x0000, 0x0165, 0x0000, 0x0167, 0x0000, 0x0169, 0x0000, 0x016B, 0x0000, 0x016D, 0x0000, 0x016F, 0x0000,
-                                     0x0171, 0x0000, 0x0173, 0x0000, 0x0175, 0x0000, 0x0177, 0x0000, 0x00FF, 0x017A, 0x0000, 0x017C, 0x0000, 0x017E, 0x0000, 0x0000 };
-static const u16 lower_data5[]   = { 0x0000, 0x0253, 0x0183, 0x0000, 0x0185, 0x0000, 0x0254, 0x0188, 0x0000, 0x0256, 0x0257, 0x018C, 0x0000, 0x0000, 0x01DD, 0x0259,
-                                     0x025B, 0x0192, 0x0000, 0x0260, 0x0263, 0x0000, 0x0269, 0x0268, 0x0199, 0x0000, 0x0000, 0x0000, 0x026F, 0x0272, 0x0000, 0x0275,
-                                     0x01A1, 0x0000, 0x01A3, 0x0000, 0x01A5, 0x0000, 0x0280, 0x01A8, 0x0000, 0x0283, 0x0000, 0x0000, 0x01AD, 0x0000, 0x0288, 0x01B0,
-                                     0x0000, 0x028A, 0x028B, 0x01B4, 0x0000, 0x01B6, 0x0000, 0x0292, 0x01B9, 0x0000, 0x0000, 0x0000, 0x01BD, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data6[]   = { 0x0000, 0x0000, 0x0000, 0x0000, 0x01C6, 0x01C6, 0x0000, 0x01C9, 0x01C9, 0x0000, 0x01CC, 0x01CC, 0x0000, 0x01CE, 0x0000, 0x01D0,
-                                     0x0000, 0x01D2, 0x0000, 0x01D4, 0x0000, 0x01D6, 0x0000, 0x01D8, 0x0000, 0x01DA, 0x0000, 0x01DC, 0x0000, 0x0000, 0x01DF, 0x0000,
-                                     0x01E1, 0x0000, 0x01E3, 0x0000, 0x01E5, 0x0000, 0x01E7, 0x0000, 0x01E9, 0x0000, 0x01EB, 0x0000, 0x01ED, 0x0000, 0x01EF, 0x0000,
-                                     0x0000, 0x01F3, 0x01F3, 0x0000, 0x01F5, 0x0000, 0x0195, 0x01BF, 0x01F9, 0x0000, 0x01FB, 0x0000, 0x01FD, 0x0000, 0x01FF, 0x0000 };
-static const u16 lower_data7[]   = { 0x0201, 0x0000, 0x0203, 0x0000, 0x0205, 0x0000, 0x0207, 0x0000, 0x0209, 0x0000, 0x020B, 0x0000, 0x020D, 0x0000, 0x020F, 0x0000,
-                                     0x0211, 0x0000, 0x0213, 0x0000, 0x0215, 0x0000, 0x0217, 0x0000, 0x0219, 0x0000, 0x021B, 0x0000, 0x021D, 0x0000, 0x021F, 0x0000,
-                                     0x019E, 0x0000, 0x0223, 0x0000, 0x0225, 0x0000, 0x0227, 0x0000, 0x0229, 0x0000, 0x022B, 0x0000, 0x022D, 0x0000, 0x022F, 0x0000,
-                                     0x0231, 0x0000, 0x0233, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2C65, 0x023C, 0x0000, 0x019A, 0x2C66, 0x0000 };
-static const u16 lower_data8[]   = { 0x0000, 0x0242, 0x0000, 0x0180, 0x0289, 0x028C, 0x0247, 0x0000, 0x0249, 0x0000, 0x024B, 0x0000, 0x024D, 0x0000, 0x024F, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data9[]   = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0371, 0x0000, 0x0373, 0x0000, 0x0000, 0x0000, 0x0377, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data10[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03AC, 0x0000, 0x03AD, 0x03AE, 0x03AF, 0x0000, 0x03CC, 0x0000, 0x03CD, 0x03CE,
-                                     0x0000, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF,
-                                     0x03C0, 0x03C1, 0x0000, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x03CA, 0x03CB, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data11[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03D7,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03D9, 0x0000, 0x03DB, 0x0000, 0x03DD, 0x0000, 0x03DF, 0x0000,
-                                     0x03E1, 0x0000, 0x03E3, 0x0000, 0x03E5, 0x0000, 0x03E7, 0x0000, 0x03E9, 0x0000, 0x03EB, 0x0000, 0x03ED, 0x0000, 0x03EF, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x03B8, 0x0000, 0x0000, 0x03F8, 0x0000, 0x03F2, 0x03FB, 0x0000, 0x0000, 0x037B, 0x037C, 0x037D };
-static const u16 lower_data12[]  = { 0x0450, 0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457, 0x0458, 0x0459, 0x045A, 0x045B, 0x045C, 0x045D, 0x045E, 0x045F,
-                                     0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
-                                     0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data13[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0461, 0x0000, 0x0463, 0x0000, 0x0465, 0x0000, 0x0467, 0x0000, 0x0469, 0x0000, 0x046B, 0x0000, 0x046D, 0x0000, 0x046F, 0x0000,
-                                     0x0471, 0x0000, 0x0473, 0x0000, 0x0475, 0x0000, 0x0477, 0x0000, 0x0479, 0x0000, 0x047B, 0x0000, 0x047D, 0x0000, 0x047F, 0x0000 };
-static const u16 lower_data14[]  = { 0x0481, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x048B, 0x0000, 0x048D, 0x0000, 0x048F, 0x0000,
-                                     0x0491, 0x0000, 0x0493, 0x0000, 0x0495, 0x0000, 0x0497, 0x0000, 0x0499, 0x0000, 0x049B, 0x0000, 0x049D, 0x0000, 0x049F, 0x0000,
-                                     0x04A1, 0x0000, 0x04A3, 0x0000, 0x04A5, 0x0000, 0x04A7, 0x0000, 0x04A9, 0x0000, 0x04AB, 0x0000, 0x04AD, 0x0000, 0x04AF, 0x0000,
-                                     0x04B1, 0x0000, 0x04B3, 0x0000, 0x04B5, 0x0000, 0x04B7, 0x0000, 0x04B9, 0x0000, 0x04BB, 0x0000, 0x04BD, 0x0000, 0x04BF, 0x0000 };
-static const u16 lower_data15[]  = { 0x04CF, 0x04C2, 0x0000, 0x04C4, 0x0000, 0x04C6, 0x0000, 0x04C8, 0x0000, 0x04CA, 0x0000, 0x04CC, 0x0000, 0x04CE, 0x0000, 0x0000,
-                                     0x04D1, 0x0000, 0x04D3, 0x0000, 0x04D5, 0x0000, 0x04D7, 0x0000, 0x04D9, 0x0000, 0x04DB, 0x0000, 0x04DD, 0x0000, 0x04DF, 0x0000,
-                                     0x04E1, 0x0000, 0x04E3, 0x0000, 0x04E5, 0x0000, 0x04E7, 0x0000, 0x04E9, 0x0000, 0x04EB, 0x0000, 0x04ED, 0x0000, 0x04EF, 0x0000,
-                                     0x04F1, 0x0000, 0x04F3, 0x0000, 0x04F5, 0x0000, 0x04F7, 0x0000, 0x04F9, 0x0000, 0x04FB, 0x0000, 0x04FD, 0x0000, 0x04FF, 0x0000 };
-static const u16 lower_data16[]  = { 0x0501, 0x0000, 0x0503, 0x0000, 0x0505, 0x0000, 0x0507, 0x0000, 0x0509, 0x0000, 0x050B, 0x0000, 0x050D, 0x0000, 0x050F, 0x0000,
-                                     0x0511, 0x0000, 0x0513, 0x0000, 0x0515, 0x0000, 0x0517, 0x0000, 0x0519, 0x0000, 0x051B, 0x0000, 0x051D, 0x0000, 0x051F, 0x0000,
-                                     0x0521, 0x0000, 0x0523, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567, 0x0568, 0x0569, 0x056A, 0x056B, 0x056C, 0x056D, 0x056E, 0x056F };
-static const u16 lower_data17[]  = { 0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577, 0x0578, 0x0579, 0x057A, 0x057B, 0x057C, 0x057D, 0x057E, 0x057F,
-                                     0x0580, 0x0581, 0x0582, 0x0583, 0x0584, 0x0585, 0x0586, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data18[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x2D00, 0x2D01, 0x2D02, 0x2D03, 0x2D04, 0x2D05, 0x2D06, 0x2D07, 0x2D08, 0x2D09, 0x2D0A, 0x2D0B, 0x2D0C, 0x2D0D, 0x2D0E, 0x2D0F,
-                                     0x2D10, 0x2D11, 0x2D12, 0x2D13, 0x2D14, 0x2D15, 0x2D16, 0x2D17, 0x2D18, 0x2D19, 0x2D1A, 0x2D1B, 0x2D1C, 0x2D1D, 0x2D1E, 0x2D1F };
-static const u16 lower_data19[]  = { 0x2D20, 0x2D21, 0x2D22, 0x2D23, 0x2D24, 0x2D25, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data20[]  = { 0x1E01, 0x0000, 0x1E03, 0x0000, 0x1E05, 0x0000, 0x1E07, 0x0000, 0x1E09, 0x0000, 0x1E0B, 0x0000, 0x1E0D, 0x0000, 0x1E0F, 0x0000,
-                                     0x1E11, 0x0000, 0x1E13, 0x0000, 0x1E15, 0x0000, 0x1E17, 0x0000, 0x1E19, 0x0000, 0x1E1B, 0x0000, 0x1E1D, 0x0000, 0x1E1F, 0x0000,
-                                     0x1E21, 0x0000, 0x1E23, 0x0000, 0x1E25, 0x0000, 0x1E27, 0x0000, 0x1E29, 0x0000, 0x1E2B, 0x0000, 0x1E2D, 0x0000, 0x1E2F, 0x0000,
-                                     0x1E31, 0x0000, 0x1E33, 0x0000, 0x1E35, 0x0000, 0x1E37, 0x0000, 0x1E39, 0x0000, 0x1E3B, 0x0000, 0x1E3D, 0x0000, 0x1E3F, 0x0000 };
-static const u16 lower_data21[]  = { 0x1E41, 0x0000, 0x1E43, 0x0000, 0x1E45, 0x0000, 0x1E47, 0x0000, 0x1E49, 0x0000, 0x1E4B, 0x0000, 0x1E4D, 0x0000, 0x1E4F, 0x0000,
-                                     0x1E51, 0x0000, 0x1E53, 0x0000, 0x1E55, 0x0000, 0x1E57, 0x0000, 0x1E59, 0x0000, 0x1E5B, 0x0000, 0x1E5D, 0x0000, 0x1E5F, 0x0000,
-                                     0x1E61, 0x0000, 0x1E63, 0x0000, 0x1E65, 0x0000, 0x1E67, 0x0000, 0x1E69, 0x0000, 0x1E6B, 0x0000, 0x1E6D, 0x0000, 0x1E6F, 0x0000,
-                                     0x1E71, 0x0000, 0x1E73, 0x0000, 0x1E75, 0x0000, 0x1E77, 0x0000, 0x1E79, 0x0000, 0x1E7B, 0x0000, 0x1E7D, 0x0000, 0x1E7F, 0x0000 };
-static const u16 lower_data22[]  = { 0x1E81, 0x0000, 0x1E83, 0x0000, 0x1E85, 0x0000, 0x1E87, 0x0000, 0x1E89, 0x0000, 0x1E8B, 0x0000, 0x1E8D, 0x0000, 0x1E8F, 0x0000,
-                                     0x1E91, 0x0000, 0x1E93, 0x0000, 0x1E95, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DF, 0x0000,
-                                     0x1EA1, 0x0000, 0x1EA3, 0x0000, 0x1EA5, 0x0000, 0x1EA7, 0x0000, 0x1EA9, 0x0000, 0x1EAB, 0x0000, 0x1EAD, 0x0000, 0x1EAF, 0x0000,
-                                     0x1EB1, 0x0000, 0x1EB3, 0x0000, 0x1EB5, 0x0000, 0x1EB7, 0x0000, 0x1EB9, 0x0000, 0x1EBB, 0x0000, 0x1EBD, 0x0000, 0x1EBF, 0x0000 };
-static const u16 lower_data23[]  = { 0x1EC1, 0x0000, 0x1EC3, 0x0000, 0x1EC5, 0x0000, 0x1EC7, 0x0000, 0x1EC9, 0x0000, 0x1ECB, 0x0000, 0x1ECD, 0x0000, 0x1ECF, 0x0000,
-                                     0x1ED1, 0x0000, 0x1ED3, 0x0000, 0x1ED5, 0x0000, 0x1ED7, 0x0000, 0x1ED9, 0x0000, 0x1EDB, 0x0000, 0x1EDD, 0x0000, 0x1EDF, 0x0000,
-                                     0x1EE1, 0x0000, 0x1EE3, 0x0000, 0x1EE5, 0x0000, 0x1EE7, 0x0000, 0x1EE9, 0x0000, 0x1EEB, 0x0000, 0x1EED, 0x0000, 0x1EEF, 0x0000,
-                                     0x1EF1, 0x0000, 0x1EF3, 0x0000, 0x1EF5, 0x0000, 0x1EF7, 0x0000, 0x1EF9, 0x0000, 0x1EFB, 0x0000, 0x1EFD, 0x0000, 0x1EFF, 0x0000 };
-static const u16 lower_data24[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F00, 0x1F01, 0x1F02, 0x1F03, 0x1F04, 0x1F05, 0x1F06, 0x1F07,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F10, 0x1F11, 0x1F12, 0x1F13, 0x1F14, 0x1F15, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F20, 0x1F21, 0x1F22, 0x1F23, 0x1F24, 0x1F25, 0x1F26, 0x1F27,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F30, 0x1F31, 0x1F32, 0x1F33, 0x1F34, 0x1F35, 0x1F36, 0x1F37 };
-static const u16 lower_data25[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F40, 0x1F41, 0x1F42, 0x1F43, 0x1F44, 0x1F45, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F51, 0x0000, 0x1F53, 0x0000, 0x1F55, 0x0000, 0x1F57,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F60, 0x1F61, 0x1F62, 0x1F63, 0x1F64, 0x1F65, 0x1F66, 0x1F67,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data26[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F80, 0x1F81, 0x1F82, 0x1F83, 0x1F84, 0x1F85, 0x1F86, 0x1F87,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F90, 0x1F91, 0x1F92, 0x1F93, 0x1F94, 0x1F95, 0x1F96, 0x1F97,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1FA0, 0x1FA1, 0x1FA2, 0x1FA3, 0x1FA4, 0x1FA5, 0x1FA6, 0x1FA7,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1FB0, 0x1FB1, 0x1F70, 0x1F71, 0x1FB3, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data27[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F72, 0x1F73, 0x1F74, 0x1F75, 0x1FC3, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1FD0, 0x1FD1, 0x1F76, 0x1F77, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1FE0, 0x1FE1, 0x1F7A, 0x1F7B, 0x1FE5, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F78, 0x1F79, 0x1F7C, 0x1F7D, 0x1FF3, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data28[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03C9, 0x0000, 0x0000, 0x0000, 0x006B, 0x00E5, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x214E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data29[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x2170, 0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176, 0x2177, 0x2178, 0x2179, 0x217A, 0x217B, 0x217C, 0x217D, 0x217E, 0x217F,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data30[]  = { 0x0000, 0x0000, 0x0000, 0x2184, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data31[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24D0, 0x24D1, 0x24D2, 0x24D3, 0x24D4, 0x24D5, 0x24D6, 0x24D7, 0x24D8, 0x24D9 };
-static const u16 lower_data32[]  = { 0x24DA, 0x24DB, 0x24DC, 0x24DD, 0x24DE, 0x24DF, 0x24E0, 0x24E1, 0x24E2, 0x24E3, 0x24E4, 0x24E5, 0x24E6, 0x24E7, 0x24E8, 0x24E9,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data33[]  = { 0x2C30, 0x2C31, 0x2C32, 0x2C33, 0x2C34, 0x2C35, 0x2C36, 0x2C37, 0x2C38, 0x2C39, 0x2C3A, 0x2C3B, 0x2C3C, 0x2C3D, 0x2C3E, 0x2C3F,
-                                     0x2C40, 0x2C41, 0x2C42, 0x2C43, 0x2C44, 0x2C45, 0x2C46, 0x2C47, 0x2C48, 0x2C49, 0x2C4A, 0x2C4B, 0x2C4C, 0x2C4D, 0x2C4E, 0x2C4F,
-                                     0x2C50, 0x2C51, 0x2C52, 0x2C53, 0x2C54, 0x2C55, 0x2C56, 0x2C57, 0x2C58, 0x2C59, 0x2C5A, 0x2C5B, 0x2C5C, 0x2C5D, 0x2C5E, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data34[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x2C61, 0x0000, 0x026B, 0x1D7D, 0x027D, 0x0000, 0x0000, 0x2C68, 0x0000, 0x2C6A, 0x0000, 0x2C6C, 0x0000, 0x0251, 0x0271, 0x0250,
-                                     0x0000, 0x0000, 0x2C73, 0x0000, 0x0000, 0x2C76, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data35[]  = { 0x2C81, 0x0000, 0x2C83, 0x0000, 0x2C85, 0x0000, 0x2C87, 0x0000, 0x2C89, 0x0000, 0x2C8B, 0x0000, 0x2C8D, 0x0000, 0x2C8F, 0x0000,
-                                     0x2C91, 0x0000, 0x2C93, 0x0000, 0x2C95, 0x0000, 0x2C97, 0x0000, 0x2C99, 0x0000, 0x2C9B, 0x0000, 0x2C9D, 0x0000, 0x2C9F, 0x0000,
-                                     0x2CA1, 0x0000, 0x2CA3, 0x0000, 0x2CA5, 0x0000, 0x2CA7, 0x0000, 0x2CA9, 0x0000, 0x2CAB, 0x0000, 0x2CAD, 0x0000, 0x2CAF, 0x0000,
-                                     0x2CB1, 0x0000, 0x2CB3, 0x0000, 0x2CB5, 0x0000, 0x2CB7, 0x0000, 0x2CB9, 0x0000, 0x2CBB, 0x0000, 0x2CBD, 0x0000, 0x2CBF, 0x0000 };
-static const u16 lower_data36[]  = { 0x2CC1, 0x0000, 0x2CC3, 0x0000, 0x2CC5, 0x0000, 0x2CC7, 0x0000, 0x2CC9, 0x0000, 0x2CCB, 0x0000, 0x2CCD, 0x0000, 0x2CCF, 0x0000,
-                                     0x2CD1, 0x0000, 0x2CD3, 0x0000, 0x2CD5, 0x0000, 0x2CD7, 0x0000, 0x2CD9, 0x0000, 0x2CDB, 0x0000, 0x2CDD, 0x0000, 0x2CDF, 0x0000,
-                                     0x2CE1, 0x0000, 0x2CE3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data37[]  = { 0xA641, 0x0000, 0xA643, 0x0000, 0xA645, 0x0000, 0xA647, 0x0000, 0xA649, 0x0000, 0xA64B, 0x0000, 0xA64D, 0x0000, 0xA64F, 0x0000,
-                                     0xA651, 0x0000, 0xA653, 0x0000, 0xA655, 0x0000, 0xA657, 0x0000, 0xA659, 0x0000, 0xA65B, 0x0000, 0xA65D, 0x0000, 0xA65F, 0x0000,
-                                     0x0000, 0x0000, 0xA663, 0x0000, 0xA665, 0x0000, 0xA667, 0x0000, 0xA669, 0x0000, 0xA66B, 0x0000, 0xA66D, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data38[]  = { 0xA681, 0x0000, 0xA683, 0x0000, 0xA685, 0x0000, 0xA687, 0x0000, 0xA689, 0x0000, 0xA68B, 0x0000, 0xA68D, 0x0000, 0xA68F, 0x0000,
-                                     0xA691, 0x0000, 0xA693, 0x0000, 0xA695, 0x0000, 0xA697, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data39[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0xA723, 0x0000, 0xA725, 0x0000, 0xA727, 0x0000, 0xA729, 0x0000, 0xA72B, 0x0000, 0xA72D, 0x0000, 0xA72F, 0x0000,
-                                     0x0000, 0x0000, 0xA733, 0x0000, 0xA735, 0x0000, 0xA737, 0x0000, 0xA739, 0x0000, 0xA73B, 0x0000, 0xA73D, 0x0000, 0xA73F, 0x0000 };
-static const u16 lower_data40[]  = { 0xA741, 0x0000, 0xA743, 0x0000, 0xA745, 0x0000, 0xA747, 0x0000, 0xA749, 0x0000, 0xA74B, 0x0000, 0xA74D, 0x0000, 0xA74F, 0x0000,
-                                     0xA751, 0x0000, 0xA753, 0x0000, 0xA755, 0x0000, 0xA757, 0x0000, 0xA759, 0x0000, 0xA75B, 0x0000, 0xA75D, 0x0000, 0xA75F, 0x0000,
-                                     0xA761, 0x0000, 0xA763, 0x0000, 0xA765, 0x0000, 0xA767, 0x0000, 0xA769, 0x0000, 0xA76B, 0x0000, 0xA76D, 0x0000, 0xA76F, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA77A, 0x0000, 0xA77C, 0x0000, 0x1D79, 0xA77F, 0x0000 };
-static const u16 lower_data41[]  = { 0xA781, 0x0000, 0xA783, 0x0000, 0xA785, 0x0000, 0xA787, 0x0000, 0x0000, 0x0000, 0x0000, 0xA78C, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 lower_data42[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0xFF41, 0xFF42, 0xFF43, 0xFF44, 0xFF45, 0xFF46, 0xFF47, 0xFF48, 0xFF49, 0xFF4A, 0xFF4B, 0xFF4C, 0xFF4D, 0xFF4E, 0xFF4F,
-                                     0xFF50, 0xFF51, 0xFF52, 0xFF53, 0xFF54, 0xFF55, 0xFF56, 0xFF57, 0xFF58, 0xFF59, 0xFF5A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-
-static const u16 *lower_data_table[LOWER_BLOCK_COUNT] = {
-lower_data0,lower_data1,lower_data2,lower_data3,lower_data4,lower_data5,lower_data6,lower_data7,lower_data8,lower_data9,
-lower_data10,lower_data11,lower_data12,lower_data13,lower_data14,lower_data15,lower_data16,lower_data17,lower_data18,lower_data19,
-lower_data20,lower_data21,lower_data22,lower_data23,lower_data24,lower_data25,lower_data26,lower_data27,lower_data28,lower_data29,
-lower_data30,lower_data31,lower_data32,lower_data33,lower_data34,lower_data35,lower_data36,lower_data37,lower_data38,lower_data39,
-lower_data40,lower_data41,lower_data42
-};
-/* Generated by JcD. Do not modify. End lower_tables */
-
 SQLITE_PRIVATE u32 unifuzz_lower(
     u32 c
 ){
-    u32 p;
-    if (c >= 0x10000) return c;
-    p = (lower_data_table[lower_indexes[(c) >> LOWER_BLOCK_SHIFT]][(c) & LOWER_BLOCK_MASK]);
-    return (p == 0) ? c : p;
-}
-
-
-/* Generated by builder. Do not modify. Start upper_defines */
-#define UPPER_BLOCK_SHIFT 6
-#define UPPER_BLOCK_MASK ((1 << UPPER_BLOCK_SHIFT) - 1)
-#define UPPER_BLOCK_SIZE (1 << UPPER_BLOCK_SHIFT)
-#define UPPER_BLOCK_COUNT 44
-#define UPPER_INDEXES_SIZE (0x10000 >> UPPER_BLOCK_SHIFT)
-/* Generated by builder. Do not modify. End upper_defines */
-
-/*  JcD upper  */
-static const u16 upper_indexes[UPPER_INDEXES_SIZE] = {
-   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,   0,   0,  11,  12,
-  13,  14,  15,  16,  17,  18,  19,  20,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  21,   0,   0,
-  22,  23,  24,  25,  26,  27,  28,  29,   0,   0,   0,   0,   0,  30,  31,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  32,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  33,  34,  35,  36,
-  37,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,  38,  39,   0,  40,  41,  42,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,  43,   0
-};
+    return PROPS_MAP(c, unifuzz_props(c, 0)->lower);
+}
 
-static const u16 upper_data0[]   = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 upper_data1[]   = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
-                                     0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 upper_data2[]   = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x039C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 upper_data3[]   = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
-                                     0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x0000, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x0178 };
-static const u16 upper_data4[]   = { 0x0000, 0x0100, 0x0000, 0x0102, 0x0000, 0x0104, 0x0000, 0x0106, 0x0000, 0x0108, 0x0000, 0x010A, 0x0000, 0x010C, 0x0000, 0x010E,
-                                     0x0000, 0x0110, 0x0000, 0x0112, 0x0000, 0x0114, 0x0000, 0x0116, 0x0000, 0x0118, 0x0000, 0x011A, 0x0000, 0x011C, 0x0000, 0x011E,
-                                     0x0000, 0x0120, 0x0000, 0x0122, 0x0000, 0x0124, 0x0000, 0x0126, 0x0000, 0x0128, 0x0000, 0x012A, 0x0000, 0x012C, 0x0000, 0x012E,
-                                     0x0000, 0x0049, 0x0000, 0x0132, 0x0000, 0x0134, 0x0000, 0x0136, 0x0000, 0x0000, 0x0139, 0x0000, 0x013B, 0x0000, 0x013D, 0x0000 };
-static const u16 upper_data5[]   = { 0x013F, 0x0000, 0x0141, 0x0000, 0x0143, 0x0000, 0x0145, 0x0000, 0x0147, 0x0000, 0x0000, 0x014A, 0x0000, 0x014C, 0x0000, 0x014E,
-                                     0x0000, 0x0150, 0x0000, 0x0152, 0x0000, 0x0154, 0x0000, 0x0156, 0x0000, 0x0158, 0x0000, 0x015A, 0x0000, 0x015C, 0x0000, 0x015E,
-                                     0x0000, 0x0160, 0x0000, 0x0162, 0x0000, 0x0164, 0x0000, 0x0166, 0x0000, 0x0168, 0x0000, 0x016A, 0x0000, 0x016C, 0x0000, 0x016E,
-                                     0x0000, 0x0170, 0x0000, 0x0172, 0x0000, 0x0174, 0x0000, 0x0176, 0x0000, 0x0000, 0x0179, 0x0000, 0x017B, 0x0000, 0x017D, 0x0053 };
-static const u16 upper_data6[]   = { 0x0243, 0x0000, 0x0000, 0x0182, 0x0000, 0x0184, 0x0000, 0x0000, 0x0187, 0x0000, 0x0000, 0x0000, 0x018B, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0191, 0x0000, 0x0000, 0x01F6, 0x0000, 0x0000, 0x0000, 0x0198, 0x023D, 0x0000, 0x0000, 0x0000, 0x0220, 0x0000,
-                                     0x0000, 0x01A0, 0x0000, 0x01A2, 0x0000, 0x01A4, 0x0000, 0x0000, 0x01A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x01AC, 0x0000, 0x0000,
-                                     0x01AF, 0x0000, 0x0000, 0x0000, 0x01B3, 0x0000, 0x01B5, 0x0000, 0x0000, 0x01B8, 0x0000, 0x0000, 0x0000, 0x01BC, 0x0000, 0x01F7 };
-static const u16 upper_data7[]   = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C4, 0x01C4, 0x0000, 0x01C7, 0x01C7, 0x0000, 0x01CA, 0x01CA, 0x0000, 0x01CD, 0x0000,
-                                     0x01CF, 0x0000, 0x01D1, 0x0000, 0x01D3, 0x0000, 0x01D5, 0x0000, 0x01D7, 0x0000, 0x01D9, 0x0000, 0x01DB, 0x018E, 0x0000, 0x01DE,
-                                     0x0000, 0x01E0, 0x0000, 0x01E2, 0x0000, 0x01E4, 0x0000, 0x01E6, 0x0000, 0x01E8, 0x0000, 0x01EA, 0x0000, 0x01EC, 0x0000, 0x01EE,
-                                     0x0000, 0x0000, 0x01F1, 0x01F1, 0x0000, 0x01F4, 0x0000, 0x0000, 0x0000, 0x01F8, 0x0000, 0x01FA, 0x0000, 0x01FC, 0x0000, 0x01FE };
-static const u16 upper_data8[]   = { 0x0000, 0x0200, 0x0000, 0x0202, 0x0000, 0x0204, 0x0000, 0x0206, 0x0000, 0x0208, 0x0000, 0x020A, 0x0000, 0x020C, 0x0000, 0x020E,
-                                     0x0000, 0x0210, 0x0000, 0x0212, 0x0000, 0x0214, 0x0000, 0x0216, 0x0000, 0x0218, 0x0000, 0x021A, 0x0000, 0x021C, 0x0000, 0x021E,
-                                     0x0000, 0x0000, 0x0000, 0x0222, 0x0000, 0x0224, 0x0000, 0x0226, 0x0000, 0x0228, 0x0000, 0x022A, 0x0000, 0x022C, 0x0000, 0x022E,
-                                     0x0000, 0x0230, 0x0000, 0x0232, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x023B, 0x0000, 0x0000, 0x0000 };
-static const u16 upper_data9[]   = { 0x0000, 0x0000, 0x0241, 0x0000, 0x0000, 0x0000, 0x0000, 0x0246, 0x0000, 0x0248, 0x0000, 0x024A, 0x0000, 0x024C, 0x0000, 0x024E,
-                                     0x2C6F, 0x2C6D, 0x0000, 0x0181, 0x0186, 0x0000, 0x0189, 0x018A, 0x0000, 0x018F, 0x0000, 0x0190, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0193, 0x0000, 0x0000, 0x0194, 0x0000, 0x0000, 0x0000, 0x0000, 0x0197, 0x0196, 0x0000, 0x2C62, 0x0000, 0x0000, 0x0000, 0x019C,
-                                     0x0000, 0x2C6E, 0x019D, 0x0000, 0x0000, 0x019F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2C64, 0x0000, 0x0000 };
-static const u16 upper_data10[]  = { 0x01A6, 0x0000, 0x0000, 0x01A9, 0x0000, 0x0000, 0x0000, 0x0000, 0x01AE, 0x0244, 0x01B1, 0x01B2, 0x0245, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x01B7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 upper_data11[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0399, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0370, 0x0000, 0x0372, 0x0000, 0x0000, 0x0000, 0x0376, 0x0000, 0x0000, 0x0000, 0x03FD, 0x03FE, 0x03FF, 0x0000, 0x0000 };
-static const u16 upper_data12[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0386, 0x0388, 0x0389, 0x038A,
-                                     0x0000, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F };
-static const u16 upper_data13[]  = { 0x03A0, 0x03A1, 0x03A3, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03AA, 0x03AB, 0x038C, 0x038E, 0x038F, 0x0000,
-                                     0x0392, 0x0398, 0x0000, 0x0000, 0x0000, 0x03A6, 0x03A0, 0x03CF, 0x0000, 0x03D8, 0x0000, 0x03DA, 0x0000, 0x03DC, 0x0000, 0x03DE,
-                                     0x0000, 0x03E0, 0x0000, 0x03E2, 0x0000, 0x03E4, 0x0000, 0x03E6, 0x0000, 0x03E8, 0x0000, 0x03EA, 0x0000, 0x03EC, 0x0000, 0x03EE,
-                                     0x039A, 0x03A1, 0x03F9, 0x0000, 0x0000, 0x0395, 0x0000, 0x0000, 0x03F7, 0x0000, 0x0000, 0x03FA, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 upper_data14[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F };
-static const u16 upper_data15[]  = { 0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
-                                     0x0400, 0x0401, 0x0402, 0x0403, 0x0404, 0x0405, 0x0406, 0x0407, 0x0408, 0x0409, 0x040A, 0x040B, 0x040C, 0x040D, 0x040E, 0x040F,
-                                     0x0000, 0x0460, 0x0000, 0x0462, 0x0000, 0x0464, 0x0000, 0x0466, 0x0000, 0x0468, 0x0000, 0x046A, 0x0000, 0x046C, 0x0000, 0x046E,
-                                     0x0000, 0x0470, 0x0000, 0x0472, 0x0000, 0x0474, 0x0000, 0x0476, 0x0000, 0x0478, 0x0000, 0x047A, 0x0000, 0x047C, 0x0000, 0x047E };
-static const u16 upper_data16[]  = { 0x0000, 0x0480, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x048A, 0x0000, 0x048C, 0x0000, 0x048E,
-                                     0x0000, 0x0490, 0x0000, 0x0492, 0x0000, 0x0494, 0x0000, 0x0496, 0x0000, 0x0498, 0x0000, 0x049A, 0x0000, 0x049C, 0x0000, 0x049E,
-                                     0x0000, 0x04A0, 0x0000, 0x04A2, 0x0000, 0x04A4, 0x0000, 0x04A6, 0x0000, 0x04A8, 0x0000, 0x04AA, 0x0000, 0x04AC, 0x0000, 0x04AE,
-                                     0x0000, 0x04B0, 0x0000, 0x04B2, 0x0000, 0x04B4, 0x0000, 0x04B6, 0x0000, 0x04B8, 0x0000, 0x04BA, 0x0000, 0x04BC, 0x0000, 0x04BE };
-static const u16 upper_data17[]  = { 0x0000, 0x0000, 0x04C1, 0x0000, 0x04C3, 0x0000, 0x04C5, 0x0000, 0x04C7, 0x0000, 0x04C9, 0x0000, 0x04CB, 0x0000, 0x04CD, 0x04C0,
-                                     0x0000, 0x04D0, 0x0000, 0x04D2, 0x0000, 0x04D4, 0x0000, 0x04D6, 0x0000, 0x04D8, 0x0000, 0x04DA, 0x0000, 0x04DC, 0x0000, 0x04DE,
-                                     0x0000, 0x04E0, 0x0000, 0x04E2, 0x0000, 0x04E4, 0x0000, 0x04E6, 0x0000, 0x04E8, 0x0000, 0x04EA, 0x0000, 0x04EC, 0x0000, 0x04EE,
-                                     0x0000, 0x04F0, 0x0000, 0x04F2, 0x0000, 0x04F4, 0x0000, 0x04F6, 0x0000, 0x04F8, 0x0000, 0x04FA, 0x0000, 0x04FC, 0x0000, 0x04FE };
-static const u16 upper_data18[]  = { 0x0000, 0x0500, 0x0000, 0x0502, 0x0000, 0x0504, 0x0000, 0x0506, 0x0000, 0x0508, 0x0000, 0x050A, 0x0000, 0x050C, 0x0000, 0x050E,
-                                     0x0000, 0x0510, 0x0000, 0x0512, 0x0000, 0x0514, 0x0000, 0x0516, 0x0000, 0x0518, 0x0000, 0x051A, 0x0000, 0x051C, 0x0000, 0x051E,
-                                     0x0000, 0x0520, 0x0000, 0x0522, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 upper_data19[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0531, 0x0532, 0x0533, 0x0534, 0x0535, 0x0536, 0x0537, 0x0538, 0x0539, 0x053A, 0x053B, 0x053C, 0x053D, 0x053E, 0x053F,
-                                     0x0540, 0x0541, 0x0542, 0x0543, 0x0544, 0x0545, 0x0546, 0x0547, 0x0548, 0x0549, 0x054A, 0x054B, 0x054C, 0x054D, 0x054E, 0x054F };
-static const u16 upper_data20[]  = { 0x0550, 0x0551, 0x0552, 0x0553, 0x0554, 0x0555, 0x0556, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 upper_data21[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA77D, 0x0000, 0x0000, 0x0000, 0x2C63, 0x0000, 0x0000 };
-static const u16 upper_data22[]  = { 0x0000, 0x1E00, 0x0000, 0x1E02, 0x0000, 0x1E04, 0x0000, 0x1E06, 0x0000, 0x1E08, 0x0000, 0x1E0A, 0x0000, 0x1E0C, 0x0000, 0x1E0E,
-                                     0x0000, 0x1E10, 0x0000, 0x1E12, 0x0000, 0x1E14, 0x0000, 0x1E16, 0x0000, 0x1E18, 0x0000, 0x1E1A, 0x0000, 0x1E1C, 0x0000, 0x1E1E,
-                                     0x0000, 0x1E20, 0x0000, 0x1E22, 0x0000, 0x1E24, 0x0000, 0x1E26, 0x0000, 0x1E28, 0x0000, 0x1E2A, 0x0000, 0x1E2C, 0x0000, 0x1E2E,
-                                     0x0000, 0x1E30, 0x0000, 0x1E32, 0x0000, 0x1E34, 0x0000, 0x1E36, 0x0000, 0x1E38, 0x0000, 0x1E3A, 0x0000, 0x1E3C, 0x0000, 0x1E3E };
-static const u16 upper_data23[]  = { 0x0000, 0x1E40, 0x0000, 0x1E42, 0x0000, 0x1E44, 0x0000, 0x1E46, 0x0000, 0x1E48, 0x0000, 0x1E4A, 0x0000, 0x1E4C, 0x0000, 0x1E4E,
-                                     0x0000, 0x1E50, 0x0000, 0x1E52, 0x0000, 0x1E54, 0x0000, 0x1E56, 0x0000, 0x1E58, 0x0000, 0x1E5A, 0x0000, 0x1E5C, 0x0000, 0x1E5E,
-                                     0x0000, 0x1E60, 0x0000, 0x1E62, 0x0000, 0x1E64, 0x0000, 0x1E66, 0x0000, 0x1E68, 0x0000, 0x1E6A, 0x0000, 0x1E6C, 0x0000, 0x1E6E,
-                                     0x0000, 0x1E70, 0x0000, 0x1E72, 0x0000, 0x1E74, 0x0000, 0x1E76, 0x0000, 0x1E78, 0x0000, 0x1E7A, 0x0000, 0x1E7C, 0x0000, 0x1E7E };
-static const u16 upper_data24[]  = { 0x0000, 0x1E80, 0x0000, 0x1E82, 0x0000, 0x1E84, 0x0000, 0x1E86, 0x0000, 0x1E88, 0x0000, 0x1E8A, 0x0000, 0x1E8C, 0x0000, 0x1E8E,
-                                     0x0000, 0x1E90, 0x0000, 0x1E92, 0x0000, 0x1E94, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1E60, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x1EA0, 0x0000, 0x1EA2, 0x0000, 0x1EA4, 0x0000, 0x1EA6, 0x0000, 0x1EA8, 0x0000, 0x1EAA, 0x0000, 0x1EAC, 0x0000, 0x1EAE,
-                                     0x0000, 0x1EB0, 0x0000, 0x1EB2, 0x0000, 0x1EB4, 0x0000, 0x1EB6, 0x0000, 0x1EB8, 0x0000, 0x1EBA, 0x0000, 0x1EBC, 0x0000, 0x1EBE };
-static const u16 upper_data25[]  = { 0x0000, 0x1EC0, 0x0000, 0x1EC2, 0x0000, 0x1EC4, 0x0000, 0x1EC6, 0x0000, 0x1EC8, 0x0000, 0x1ECA, 0x0000, 0x1ECC, 0x0000, 0x1ECE,
-                                     0x0000, 0x1ED0, 0x0000, 0x1ED2, 0x0000, 0x1ED4, 0x0000, 0x1ED6, 0x0000, 0x1ED8, 0x0000, 0x1EDA, 0x0000, 0x1EDC, 0x0000, 0x1EDE,
-                                     0x0000, 0x1EE0, 0x0000, 0x1EE2, 0x0000, 0x1EE4, 0x0000, 0x1EE6, 0x0000, 0x1EE8, 0x0000, 0x1EEA, 0x0000, 0x1EEC, 0x0000, 0x1EEE,
-                                     0x0000, 0x1EF0, 0x0000, 0x1EF2, 0x0000, 0x1EF4, 0x0000, 0x1EF6, 0x0000, 0x1EF8, 0x0000, 0x1EFA, 0x0000, 0x1EFC, 0x0000, 0x1EFE };
-static const u16 upper_data26[]  = { 0x1F08, 0x1F09, 0x1F0A, 0x1F0B, 0x1F0C, 0x1F0D, 0x1F0E, 0x1F0F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1F18, 0x1F19, 0x1F1A, 0x1F1B, 0x1F1C, 0x1F1D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1F28, 0x1F29, 0x1F2A, 0x1F2B, 0x1F2C, 0x1F2D, 0x1F2E, 0x1F2F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1F38, 0x1F39, 0x1F3A, 0x1F3B, 0x1F3C, 0x1F3D, 0x1F3E, 0x1F3F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 upper_data27[]  = { 0x1F48, 0x1F49, 0x1F4A, 0x1F4B, 0x1F4C, 0x1F4D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x1F59, 0x0000, 0x1F5B, 0x0000, 0x1F5D, 0x0000, 0x1F5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1F68, 0x1F69, 0x1F6A, 0x1F6B, 0x1F6C, 0x1F6D, 0x1F6E, 0x1F6F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1FBA, 0x1FBB, 0x1FC8, 0x1FC9, 0x1FCA, 0x1FCB, 0x1FDA, 0x1FDB, 0x1FF8, 0x1FF9, 0x1FEA, 0x1FEB, 0x1FFA, 0x1FFB, 0x0000, 0x0000 };
-static const u16 upper_data28[]  = { 0x1F88, 0x1F89, 0x1F8A, 0x1F8B, 0x1F8C, 0x1F8D, 0x1F8E, 0x1F8F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1F98, 0x1F99, 0x1F9A, 0x1F9B, 0x1F9C, 0x1F9D, 0x1F9E, 0x1F9F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1FA8, 0x1FA9, 0x1FAA, 0x1FAB, 0x1FAC, 0x1FAD, 0x1FAE, 0x1FAF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1FB8, 0x1FB9, 0x0000, 0x1FBC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0399, 0x0000 };
-static const u16 upper_data29[]  = { 0x0000, 0x0000, 0x0000, 0x1FCC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1FD8, 0x1FD9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1FE8, 0x1FE9, 0x0000, 0x0000, 0x0000, 0x1FEC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x1FFC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 upper_data30[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2132, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x2160, 0x2161, 0x2162, 0x2163, 0x2164, 0x2165, 0x2166, 0x2167, 0x2168, 0x2169, 0x216A, 0x216B, 0x216C, 0x216D, 0x216E, 0x216F };
-static const u16 upper_data31[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x2183, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 upper_data32[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x24B6, 0x24B7, 0x24B8, 0x24B9, 0x24BA, 0x24BB, 0x24BC, 0x24BD, 0x24BE, 0x24BF, 0x24C0, 0x24C1, 0x24C2, 0x24C3, 0x24C4, 0x24C5,
-                                     0x24C6, 0x24C7, 0x24C8, 0x24C9, 0x24CA, 0x24CB, 0x24CC, 0x24CD, 0x24CE, 0x24CF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 upper_data33[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x2C00, 0x2C01, 0x2C02, 0x2C03, 0x2C04, 0x2C05, 0x2C06, 0x2C07, 0x2C08, 0x2C09, 0x2C0A, 0x2C0B, 0x2C0C, 0x2C0D, 0x2C0E, 0x2C0F };
-static const u16 upper_data34[]  = { 0x2C10, 0x2C11, 0x2C12, 0x2C13, 0x2C14, 0x2C15, 0x2C16, 0x2C17, 0x2C18, 0x2C19, 0x2C1A, 0x2C1B, 0x2C1C, 0x2C1D, 0x2C1E, 0x2C1F,
-                                     0x2C20, 0x2C21, 0x2C22, 0x2C23, 0x2C24, 0x2C25, 0x2C26, 0x2C27, 0x2C28, 0x2C29, 0x2C2A, 0x2C2B, 0x2C2C, 0x2C2D, 0x2C2E, 0x0000,
-                                     0x0000, 0x2C60, 0x0000, 0x0000, 0x0000, 0x023A, 0x023E, 0x0000, 0x2C67, 0x0000, 0x2C69, 0x0000, 0x2C6B, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x2C72, 0x0000, 0x0000, 0x2C75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 upper_data35[]  = { 0x0000, 0x2C80, 0x0000, 0x2C82, 0x0000, 0x2C84, 0x0000, 0x2C86, 0x0000, 0x2C88, 0x0000, 0x2C8A, 0x0000, 0x2C8C, 0x0000, 0x2C8E,
-                                     0x0000, 0x2C90, 0x0000, 0x2C92, 0x0000, 0x2C94, 0x0000, 0x2C96, 0x0000, 0x2C98, 0x0000, 0x2C9A, 0x0000, 0x2C9C, 0x0000, 0x2C9E,
-                                     0x0000, 0x2CA0, 0x0000, 0x2CA2, 0x0000, 0x2CA4, 0x0000, 0x2CA6, 0x0000, 0x2CA8, 0x0000, 0x2CAA, 0x0000, 0x2CAC, 0x0000, 0x2CAE,
-                                     0x0000, 0x2CB0, 0x0000, 0x2CB2, 0x0000, 0x2CB4, 0x0000, 0x2CB6, 0x0000, 0x2CB8, 0x0000, 0x2CBA, 0x0000, 0x2CBC, 0x0000, 0x2CBE };
-static const u16 upper_data36[]  = { 0x0000, 0x2CC0, 0x0000, 0x2CC2, 0x0000, 0x2CC4, 0x0000, 0x2CC6, 0x0000, 0x2CC8, 0x0000, 0x2CCA, 0x0000, 0x2CCC, 0x0000, 0x2CCE,
-                                     0x0000, 0x2CD0, 0x0000, 0x2CD2, 0x0000, 0x2CD4, 0x0000, 0x2CD6, 0x0000, 0x2CD8, 0x0000, 0x2CDA, 0x0000, 0x2CDC, 0x0000, 0x2CDE,
-                                     0x0000, 0x2CE0, 0x0000, 0x2CE2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 upper_data37[]  = { 0x10A0, 0x10A1, 0x10A2, 0x10A3, 0x10A4, 0x10A5, 0x10A6, 0x10A7, 0x10A8, 0x10A9, 0x10AA, 0x10AB, 0x10AC, 0x10AD, 0x10AE, 0x10AF,
-                                     0x10B0, 0x10B1, 0x10B2, 0x10B3, 0x10B4, 0x10B5, 0x10B6, 0x10B7, 0x10B8, 0x10B9, 0x10BA, 0x10BB, 0x10BC, 0x10BD, 0x10BE, 0x10BF,
-                                     0x10C0, 0x10C1, 0x10C2, 0x10C3, 0x10C4, 0x10C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 upper_data38[]  = { 0x0000, 0xA640, 0x0000, 0xA642, 0x0000, 0xA644, 0x0000, 0xA646, 0x0000, 0xA648, 0x0000, 0xA64A, 0x0000, 0xA64C, 0x0000, 0xA64E,
-                                     0x0000, 0xA650, 0x0000, 0xA652, 0x0000, 0xA654, 0x0000, 0xA656, 0x0000, 0xA658, 0x0000, 0xA65A, 0x0000, 0xA65C, 0x0000, 0xA65E,
-                                     0x0000, 0x0000, 0x0000, 0xA662, 0x0000, 0xA664, 0x0000, 0xA666, 0x0000, 0xA668, 0x0000, 0xA66A, 0x0000, 0xA66C, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 upper_data39[]  = { 0x0000, 0xA680, 0x0000, 0xA682, 0x0000, 0xA684, 0x0000, 0xA686, 0x0000, 0xA688, 0x0000, 0xA68A, 0x0000, 0xA68C, 0x0000, 0xA68E,
-                                     0x0000, 0xA690, 0x0000, 0xA692, 0x0000, 0xA694, 0x0000, 0xA696, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 upper_data40[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0xA722, 0x0000, 0xA724, 0x0000, 0xA726, 0x0000, 0xA728, 0x0000, 0xA72A, 0x0000, 0xA72C, 0x0000, 0xA72E,
-                                     0x0000, 0x0000, 0x0000, 0xA732, 0x0000, 0xA734, 0x0000, 0xA736, 0x0000, 0xA738, 0x0000, 0xA73A, 0x0000, 0xA73C, 0x0000, 0xA73E };
-static const u16 upper_data41[]  = { 0x0000, 0xA740, 0x0000, 0xA742, 0x0000, 0xA744, 0x0000, 0xA746, 0x0000, 0xA748, 0x0000, 0xA74A, 0x0000, 0xA74C, 0x0000, 0xA74E,
-                                     0x0000, 0xA750, 0x0000, 0xA752, 0x0000, 0xA754, 0x0000, 0xA756, 0x0000, 0xA758, 0x0000, 0xA75A, 0x0000, 0xA75C, 0x0000, 0xA75E,
-                                     0x0000, 0xA760, 0x0000, 0xA762, 0x0000, 0xA764, 0x0000, 0xA766, 0x0000, 0xA768, 0x0000, 0xA76A, 0x0000, 0xA76C, 0x0000, 0xA76E,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA779, 0x0000, 0xA77B, 0x0000, 0x0000, 0xA77E };
-static const u16 upper_data42[]  = { 0x0000, 0xA780, 0x0000, 0xA782, 0x0000, 0xA784, 0x0000, 0xA786, 0x0000, 0x0000, 0x0000, 0x0000, 0xA78B, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 upper_data43[]  = { 0x0000, 0xFF21, 0xFF22, 0xFF23, 0xFF24, 0xFF25, 0xFF26, 0xFF27, 0xFF28, 0xFF29, 0xFF2A, 0xFF2B, 0xFF2C, 0xFF2D, 0xFF2E, 0xFF2F,
-                                     0xFF30, 0xFF31, 0xFF32, 0xFF33, 0xFF34, 0xFF35, 0xFF36, 0xFF37, 0xFF38, 0xFF39, 0xFF3A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-
-static const u16 *upper_data_table[UPPER_BLOCK_COUNT] = {
-upper_data0,upper_data1,upper_data2,upper_data3,upper_data4,upper_data5,upper_data6,upper_data7,upper_data8,upper_data9,
-upper_data10,upper_data11,upper_data12,upper_data13,upper_data14,upper_data15,upper_data16,upper_data17,upper_data18,upper_data19,
-upper_data20,upper_data21,upper_data22,upper_data23,upper_data24,upper_data25,upper_data26,upper_data27,upper_data28,upper_data29,
-upper_data30,upper_data31,upper_data32,upper_data33,upper_data34,upper_data35,upper_data36,upper_data37,upper_data38,upper_data39,
-upper_data40,upper_data41,upper_data42,upper_data43
-};
-/* Generated by JcD. Do not modify. End upper_tables */
 
 SQLITE_PRIVATE u32 unifuzz_upper(
     u32 c
 ){
-    u32 p;
-    if (c >= 0x10000) return c;
-    p = (upper_data_table[upper_indexes[(c) >> UPPER_BLOCK_SHIFT]][(c) & UPPER_BLOCK_MASK]);
-    return (p == 0) ? c : p;
-}
-
-
-/* Generated by builder. Do not modify. Start title_defines */
-#define TITLE_BLOCK_SHIFT 6
-#define TITLE_BLOCK_MASK ((1 << TITLE_BLOCK_SHIFT) - 1)
-#define TITLE_BLOCK_SIZE (1 << TITLE_BLOCK_SHIFT)
-#define TITLE_BLOCK_COUNT 44
-#define TITLE_INDEXES_SIZE (0x10000 >> TITLE_BLOCK_SHIFT)
-/* Generated by builder. Do not modify. End title_defines */
-
-/* Generated by JcD. Do not modify. Start title_tables */
-static const u16 title_indexes[TITLE_INDEXES_SIZE] = {
-   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,   0,   0,  11,  12,
-  13,  14,  15,  16,  17,  18,  19,  20,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  21,   0,   0,
-  22,  23,  24,  25,  26,  27,  28,  29,   0,   0,   0,   0,   0,  30,  31,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  32,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  33,  34,  35,  36,
-  37,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,  38,  39,   0,  40,  41,  42,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-   0,  43,   0
-};
+    return PROPS_MAP(c, unifuzz_props(c, 0)->upper);
+}
 
-static const u16 title_data0[]   = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 title_data1[]   = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
-                                     0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 title_data2[]   = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x039C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 title_data3[]   = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
-                                     0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x0000, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x0178 };
-static const u16 title_data4[]   = { 0x0000, 0x0100, 0x0000, 0x0102, 0x0000, 0x0104, 0x0000, 0x0106, 0x0000, 0x0108, 0x0000, 0x010A, 0x0000, 0x010C, 0x0000, 0x010E,
-                                     0x0000, 0x0110, 0x0000, 0x0112, 0x0000, 0x0114, 0x0000, 0x0116, 0x0000, 0x0118, 0x0000, 0x011A, 0x0000, 0x011C, 0x0000, 0x011E,
-                                     0x0000, 0x0120, 0x0000, 0x0122, 0x0000, 0x0124, 0x0000, 0x0126, 0x0000, 0x0128, 0x0000, 0x012A, 0x0000, 0x012C, 0x0000, 0x012E,
-                                     0x0000, 0x0049, 0x0000, 0x0132, 0x0000, 0x0134, 0x0000, 0x0136, 0x0000, 0x0000, 0x0139, 0x0000, 0x013B, 0x0000, 0x013D, 0x0000 };
-static const u16 title_data5[]   = { 0x013F, 0x0000, 0x0141, 0x0000, 0x0143, 0x0000, 0x0145, 0x0000, 0x0147, 0x0000, 0x0000, 0x014A, 0x0000, 0x014C, 0x0000, 0x014E,
-                                     0x0000, 0x0150, 0x0000, 0x0152, 0x0000, 0x0154, 0x0000, 0x0156, 0x0000, 0x0158, 0x0000, 0x015A, 0x0000, 0x015C, 0x0000, 0x015E,
-                                     0x0000, 0x0160, 0x0000, 0x0162, 0x0000, 0x0164, 0x0000, 0x0166, 0x0000, 0x0168, 0x0000, 0x016A, 0x0000, 0x016C, 0x0000, 0x016E,
-                                     0x0000, 0x0170, 0x0000, 0x0172, 0x0000, 0x0174, 0x0000, 0x0176, 0x0000, 0x0000, 0x0179, 0x0000, 0x017B, 0x0000, 0x017D, 0x0053 };
-static const u16 title_data6[]   = { 0x0243, 0x0000, 0x0000, 0x0182, 0x0000, 0x0184, 0x0000, 0x0000, 0x0187, 0x0000, 0x0000, 0x0000, 0x018B, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0191, 0x0000, 0x0000, 0x01F6, 0x0000, 0x0000, 0x0000, 0x0198, 0x023D, 0x0000, 0x0000, 0x0000, 0x0220, 0x0000,
-                                     0x0000, 0x01A0, 0x0000, 0x01A2, 0x0000, 0x01A4, 0x0000, 0x0000, 0x01A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x01AC, 0x0000, 0x0000,
-                                     0x01AF, 0x0000, 0x0000, 0x0000, 0x01B3, 0x0000, 0x01B5, 0x0000, 0x0000, 0x01B8, 0x0000, 0x0000, 0x0000, 0x01BC, 0x0000, 0x01F7 };
-static const u16 title_data7[]   = { 0x0000, 0x0000, 0x0000, 0x0000, 0x01C5, 0x0000, 0x01C5, 0x01C8, 0x0000, 0x01C8, 0x01CB, 0x0000, 0x01CB, 0x0000, 0x01CD, 0x0000,
-                                     0x01CF, 0x0000, 0x01D1, 0x0000, 0x01D3, 0x0000, 0x01D5, 0x0000, 0x01D7, 0x0000, 0x01D9, 0x0000, 0x01DB, 0x018E, 0x0000, 0x01DE,
-                                     0x0000, 0x01E0, 0x0000, 0x01E2, 0x0000, 0x01E4, 0x0000, 0x01E6, 0x0000, 0x01E8, 0x0000, 0x01EA, 0x0000, 0x01EC, 0x0000, 0x01EE,
-                                     0x0000, 0x01F2, 0x0000, 0x01F2, 0x0000, 0x01F4, 0x0000, 0x0000, 0x0000, 0x01F8, 0x0000, 0x01FA, 0x0000, 0x01FC, 0x0000, 0x01FE };
-static const u16 title_data8[]   = { 0x0000, 0x0200, 0x0000, 0x0202, 0x0000, 0x0204, 0x0000, 0x0206, 0x0000, 0x0208, 0x0000, 0x020A, 0x0000, 0x020C, 0x0000, 0x020E,
-                                     0x0000, 0x0210, 0x0000, 0x0212, 0x0000, 0x0214, 0x0000, 0x0216, 0x0000, 0x0218, 0x0000, 0x021A, 0x0000, 0x021C, 0x0000, 0x021E,
-                                     0x0000, 0x0000, 0x0000, 0x0222, 0x0000, 0x0224, 0x0000, 0x0226, 0x0000, 0x0228, 0x0000, 0x022A, 0x0000, 0x022C, 0x0000, 0x022E,
-                                     0x0000, 0x0230, 0x0000, 0x0232, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x023B, 0x0000, 0x0000, 0x0000 };
-static const u16 title_data9[]   = { 0x0000, 0x0000, 0x0241, 0x0000, 0x0000, 0x0000, 0x0000, 0x0246, 0x0000, 0x0248, 0x0000, 0x024A, 0x0000, 0x024C, 0x0000, 0x024E,
-                                     0x2C6F, 0x2C6D, 0x0000, 0x0181, 0x0186, 0x0000, 0x0189, 0x018A, 0x0000, 0x018F, 0x0000, 0x0190, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0193, 0x0000, 0x0000, 0x0194, 0x0000, 0x0000, 0x0000, 0x0000, 0x0197, 0x0196, 0x0000, 0x2C62, 0x0000, 0x0000, 0x0000, 0x019C,
-                                     0x0000, 0x2C6E, 0x019D, 0x0000, 0x0000, 0x019F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2C64, 0x0000, 0x0000 };
-static const u16 title_data10[]  = { 0x01A6, 0x0000, 0x0000, 0x01A9, 0x0000, 0x0000, 0x0000, 0x0000, 0x01AE, 0x0244, 0x01B1, 0x01B2, 0x0245, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x01B7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 title_data11[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0399, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0370, 0x0000, 0x0372, 0x0000, 0x0000, 0x0000, 0x0376, 0x0000, 0x0000, 0x0000, 0x03FD, 0x03FE, 0x03FF, 0x0000, 0x0000 };
-static const u16 title_data12[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0386, 0x0388, 0x0389, 0x038A,
-                                     0x0000, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F };
-static const u16 title_data13[]  = { 0x03A0, 0x03A1, 0x03A3, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03AA, 0x03AB, 0x038C, 0x038E, 0x038F, 0x0000,
-                                     0x0392, 0x0398, 0x0000, 0x0000, 0x0000, 0x03A6, 0x03A0, 0x03CF, 0x0000, 0x03D8, 0x0000, 0x03DA, 0x0000, 0x03DC, 0x0000, 0x03DE,
-                                     0x0000, 0x03E0, 0x0000, 0x03E2, 0x0000, 0x03E4, 0x0000, 0x03E6, 0x0000, 0x03E8, 0x0000, 0x03EA, 0x0000, 0x03EC, 0x0000, 0x03EE,
-                                     0x039A, 0x03A1, 0x03F9, 0x0000, 0x0000, 0x0395, 0x0000, 0x0000, 0x03F7, 0x0000, 0x0000, 0x03FA, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 title_data14[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F };
-static const u16 title_data15[]  = { 0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
-                                     0x0400, 0x0401, 0x0402, 0x0403, 0x0404, 0x0405, 0x0406, 0x0407, 0x0408, 0x0409, 0x040A, 0x040B, 0x040C, 0x040D, 0x040E, 0x040F,
-                                     0x0000, 0x0460, 0x0000, 0x0462, 0x0000, 0x0464, 0x0000, 0x0466, 0x0000, 0x0468, 0x0000, 0x046A, 0x0000, 0x046C, 0x0000, 0x046E,
-                                     0x0000, 0x0470, 0x0000, 0x0472, 0x0000, 0x0474, 0x0000, 0x0476, 0x0000, 0x0478, 0x0000, 0x047A, 0x0000, 0x047C, 0x0000, 0x047E };
-static const u16 title_data16[]  = { 0x0000, 0x0480, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x048A, 0x0000, 0x048C, 0x0000, 0x048E,
-                                     0x0000, 0x0490, 0x0000, 0x0492, 0x0000, 0x0494, 0x0000, 0x0496, 0x0000, 0x0498, 0x0000, 0x049A, 0x0000, 0x049C, 0x0000, 0x049E,
-                                     0x0000, 0x04A0, 0x0000, 0x04A2, 0x0000, 0x04A4, 0x0000, 0x04A6, 0x0000, 0x04A8, 0x0000, 0x04AA, 0x0000, 0x04AC, 0x0000, 0x04AE,
-                                     0x0000, 0x04B0, 0x0000, 0x04B2, 0x0000, 0x04B4, 0x0000, 0x04B6, 0x0000, 0x04B8, 0x0000, 0x04BA, 0x0000, 0x04BC, 0x0000, 0x04BE };
-static const u16 title_data17[]  = { 0x0000, 0x0000, 0x04C1, 0x0000, 0x04C3, 0x0000, 0x04C5, 0x0000, 0x04C7, 0x0000, 0x04C9, 0x0000, 0x04CB, 0x0000, 0x04CD, 0x04C0,
-                                     0x0000, 0x04D0, 0x0000, 0x04D2, 0x0000, 0x04D4, 0x0000, 0x04D6, 0x0000, 0x04D8, 0x0000, 0x04DA, 0x0000, 0x04DC, 0x0000, 0x04DE,
-                                     0x0000, 0x04E0, 0x0000, 0x04E2, 0x0000, 0x04E4, 0x0000, 0x04E6, 0x0000, 0x04E8, 0x0000, 0x04EA, 0x0000, 0x04EC, 0x0000, 0x04EE,
-                                     0x0000, 0x04F0, 0x0000, 0x04F2, 0x0000, 0x04F4, 0x0000, 0x04F6, 0x0000, 0x04F8, 0x0000, 0x04FA, 0x0000, 0x04FC, 0x0000, 0x04FE };
-static const u16 title_data18[]  = { 0x0000, 0x0500, 0x0000, 0x0502, 0x0000, 0x0504, 0x0000, 0x0506, 0x0000, 0x0508, 0x0000, 0x050A, 0x0000, 0x050C, 0x0000, 0x050E,
-                                     0x0000, 0x0510, 0x0000, 0x0512, 0x0000, 0x0514, 0x0000, 0x0516, 0x0000, 0x0518, 0x0000, 0x051A, 0x0000, 0x051C, 0x0000, 0x051E,
-                                     0x0000, 0x0520, 0x0000, 0x0522, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 title_data19[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0531, 0x0532, 0x0533, 0x0534, 0x0535, 0x0536, 0x0537, 0x0538, 0x0539, 0x053A, 0x053B, 0x053C, 0x053D, 0x053E, 0x053F,
-                                     0x0540, 0x0541, 0x0542, 0x0543, 0x0544, 0x0545, 0x0546, 0x0547, 0x0548, 0x0549, 0x054A, 0x054B, 0x054C, 0x054D, 0x054E, 0x054F };
-static const u16 title_data20[]  = { 0x0550, 0x0551, 0x0552, 0x0553, 0x0554, 0x0555, 0x0556, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 title_data21[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA77D, 0x0000, 0x0000, 0x0000, 0x2C63, 0x0000, 0x0000 };
-static const u16 title_data22[]  = { 0x0000, 0x1E00, 0x0000, 0x1E02, 0x0000, 0x1E04, 0x0000, 0x1E06, 0x0000, 0x1E08, 0x0000, 0x1E0A, 0x0000, 0x1E0C, 0x0000, 0x1E0E,
-                                     0x0000, 0x1E10, 0x0000, 0x1E12, 0x0000, 0x1E14, 0x0000, 0x1E16, 0x0000, 0x1E18, 0x0000, 0x1E1A, 0x0000, 0x1E1C, 0x0000, 0x1E1E,
-                                     0x0000, 0x1E20, 0x0000, 0x1E22, 0x0000, 0x1E24, 0x0000, 0x1E26, 0x0000, 0x1E28, 0x0000, 0x1E2A, 0x0000, 0x1E2C, 0x0000, 0x1E2E,
-                                     0x0000, 0x1E30, 0x0000, 0x1E32, 0x0000, 0x1E34, 0x0000, 0x1E36, 0x0000, 0x1E38, 0x0000, 0x1E3A, 0x0000, 0x1E3C, 0x0000, 0x1E3E };
-static const u16 title_data23[]  = { 0x0000, 0x1E40, 0x0000, 0x1E42, 0x0000, 0x1E44, 0x0000, 0x1E46, 0x0000, 0x1E48, 0x0000, 0x1E4A, 0x0000, 0x1E4C, 0x0000, 0x1E4E,
-                                     0x0000, 0x1E50, 0x0000, 0x1E52, 0x0000, 0x1E54, 0x0000, 0x1E56, 0x0000, 0x1E58, 0x0000, 0x1E5A, 0x0000, 0x1E5C, 0x0000, 0x1E5E,
-                                     0x0000, 0x1E60, 0x0000, 0x1E62, 0x0000, 0x1E64, 0x0000, 0x1E66, 0x0000, 0x1E68, 0x0000, 0x1E6A, 0x0000, 0x1E6C, 0x0000, 0x1E6E,
-                                     0x0000, 0x1E70, 0x0000, 0x1E72, 0x0000, 0x1E74, 0x0000, 0x1E76, 0x0000, 0x1E78, 0x0000, 0x1E7A, 0x0000, 0x1E7C, 0x0000, 0x1E7E };
-static const u16 title_data24[]  = { 0x0000, 0x1E80, 0x0000, 0x1E82, 0x0000, 0x1E84, 0x0000, 0x1E86, 0x0000, 0x1E88, 0x0000, 0x1E8A, 0x0000, 0x1E8C, 0x0000, 0x1E8E,
-                                     0x0000, 0x1E90, 0x0000, 0x1E92, 0x0000, 0x1E94, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1E60, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x1EA0, 0x0000, 0x1EA2, 0x0000, 0x1EA4, 0x0000, 0x1EA6, 0x0000, 0x1EA8, 0x0000, 0x1EAA, 0x0000, 0x1EAC, 0x0000, 0x1EAE,
-                                     0x0000, 0x1EB0, 0x0000, 0x1EB2, 0x0000, 0x1EB4, 0x0000, 0x1EB6, 0x0000, 0x1EB8, 0x0000, 0x1EBA, 0x0000, 0x1EBC, 0x0000, 0x1EBE };
-static const u16 title_data25[]  = { 0x0000, 0x1EC0, 0x0000, 0x1EC2, 0x0000, 0x1EC4, 0x0000, 0x1EC6, 0x0000, 0x1EC8, 0x0000, 0x1ECA, 0x0000, 0x1ECC, 0x0000, 0x1ECE,
-                                     0x0000, 0x1ED0, 0x0000, 0x1ED2, 0x0000, 0x1ED4, 0x0000, 0x1ED6, 0x0000, 0x1ED8, 0x0000, 0x1EDA, 0x0000, 0x1EDC, 0x0000, 0x1EDE,
-                                     0x0000, 0x1EE0, 0x0000, 0x1EE2, 0x0000, 0x1EE4, 0x0000, 0x1EE6, 0x0000, 0x1EE8, 0x0000, 0x1EEA, 0x0000, 0x1EEC, 0x0000, 0x1EEE,
-                                     0x0000, 0x1EF0, 0x0000, 0x1EF2, 0x0000, 0x1EF4, 0x0000, 0x1EF6, 0x0000, 0x1EF8, 0x0000, 0x1EFA, 0x0000, 0x1EFC, 0x0000, 0x1EFE };
-static const u16 title_data26[]  = { 0x1F08, 0x1F09, 0x1F0A, 0x1F0B, 0x1F0C, 0x1F0D, 0x1F0E, 0x1F0F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1F18, 0x1F19, 0x1F1A, 0x1F1B, 0x1F1C, 0x1F1D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1F28, 0x1F29, 0x1F2A, 0x1F2B, 0x1F2C, 0x1F2D, 0x1F2E, 0x1F2F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1F38, 0x1F39, 0x1F3A, 0x1F3B, 0x1F3C, 0x1F3D, 0x1F3E, 0x1F3F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 title_data27[]  = { 0x1F48, 0x1F49, 0x1F4A, 0x1F4B, 0x1F4C, 0x1F4D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x1F59, 0x0000, 0x1F5B, 0x0000, 0x1F5D, 0x0000, 0x1F5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1F68, 0x1F69, 0x1F6A, 0x1F6B, 0x1F6C, 0x1F6D, 0x1F6E, 0x1F6F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1FBA, 0x1FBB, 0x1FC8, 0x1FC9, 0x1FCA, 0x1FCB, 0x1FDA, 0x1FDB, 0x1FF8, 0x1FF9, 0x1FEA, 0x1FEB, 0x1FFA, 0x1FFB, 0x0000, 0x0000 };
-static const u16 title_data28[]  = { 0x1F88, 0x1F89, 0x1F8A, 0x1F8B, 0x1F8C, 0x1F8D, 0x1F8E, 0x1F8F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1F98, 0x1F99, 0x1F9A, 0x1F9B, 0x1F9C, 0x1F9D, 0x1F9E, 0x1F9F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1FA8, 0x1FA9, 0x1FAA, 0x1FAB, 0x1FAC, 0x1FAD, 0x1FAE, 0x1FAF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1FB8, 0x1FB9, 0x0000, 0x1FBC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0399, 0x0000 };
-static const u16 title_data29[]  = { 0x0000, 0x0000, 0x0000, 0x1FCC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1FD8, 0x1FD9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x1FE8, 0x1FE9, 0x0000, 0x0000, 0x0000, 0x1FEC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x1FFC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 title_data30[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2132, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x2160, 0x2161, 0x2162, 0x2163, 0x2164, 0x2165, 0x2166, 0x2167, 0x2168, 0x2169, 0x216A, 0x216B, 0x216C, 0x216D, 0x216E, 0x216F };
-static const u16 title_data31[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x2183, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 title_data32[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x24B6, 0x24B7, 0x24B8, 0x24B9, 0x24BA, 0x24BB, 0x24BC, 0x24BD, 0x24BE, 0x24BF, 0x24C0, 0x24C1, 0x24C2, 0x24C3, 0x24C4, 0x24C5,
-                                     0x24C6, 0x24C7, 0x24C8, 0x24C9, 0x24CA, 0x24CB, 0x24CC, 0x24CD, 0x24CE, 0x24CF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 title_data33[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x2C00, 0x2C01, 0x2C02, 0x2C03, 0x2C04, 0x2C05, 0x2C06, 0x2C07, 0x2C08, 0x2C09, 0x2C0A, 0x2C0B, 0x2C0C, 0x2C0D, 0x2C0E, 0x2C0F };
-static const u16 title_data34[]  = { 0x2C10, 0x2C11, 0x2C12, 0x2C13, 0x2C14, 0x2C15, 0x2C16, 0x2C17, 0x2C18, 0x2C19, 0x2C1A, 0x2C1B, 0x2C1C, 0x2C1D, 0x2C1E, 0x2C1F,
-                                     0x2C20, 0x2C21, 0x2C22, 0x2C23, 0x2C24, 0x2C25, 0x2C26, 0x2C27, 0x2C28, 0x2C29, 0x2C2A, 0x2C2B, 0x2C2C, 0x2C2D, 0x2C2E, 0x0000,
-                                     0x0000, 0x2C60, 0x0000, 0x0000, 0x0000, 0x023A, 0x023E, 0x0000, 0x2C67, 0x0000, 0x2C69, 0x0000, 0x2C6B, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x2C72, 0x0000, 0x0000, 0x2C75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 title_data35[]  = { 0x0000, 0x2C80, 0x0000, 0x2C82, 0x0000, 0x2C84, 0x0000, 0x2C86, 0x0000, 0x2C88, 0x0000, 0x2C8A, 0x0000, 0x2C8C, 0x0000, 0x2C8E,
-                                     0x0000, 0x2C90, 0x0000, 0x2C92, 0x0000, 0x2C94, 0x0000, 0x2C96, 0x0000, 0x2C98, 0x0000, 0x2C9A, 0x0000, 0x2C9C, 0x0000, 0x2C9E,
-                                     0x0000, 0x2CA0, 0x0000, 0x2CA2, 0x0000, 0x2CA4, 0x0000, 0x2CA6, 0x0000, 0x2CA8, 0x0000, 0x2CAA, 0x0000, 0x2CAC, 0x0000, 0x2CAE,
-                                     0x0000, 0x2CB0, 0x0000, 0x2CB2, 0x0000, 0x2CB4, 0x0000, 0x2CB6, 0x0000, 0x2CB8, 0x0000, 0x2CBA, 0x0000, 0x2CBC, 0x0000, 0x2CBE };
-static const u16 title_data36[]  = { 0x0000, 0x2CC0, 0x0000, 0x2CC2, 0x0000, 0x2CC4, 0x0000, 0x2CC6, 0x0000, 0x2CC8, 0x0000, 0x2CCA, 0x0000, 0x2CCC, 0x0000, 0x2CCE,
-                                     0x0000, 0x2CD0, 0x0000, 0x2CD2, 0x0000, 0x2CD4, 0x0000, 0x2CD6, 0x0000, 0x2CD8, 0x0000, 0x2CDA, 0x0000, 0x2CDC, 0x0000, 0x2CDE,
-                                     0x0000, 0x2CE0, 0x0000, 0x2CE2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 title_data37[]  = { 0x10A0, 0x10A1, 0x10A2, 0x10A3, 0x10A4, 0x10A5, 0x10A6, 0x10A7, 0x10A8, 0x10A9, 0x10AA, 0x10AB, 0x10AC, 0x10AD, 0x10AE, 0x10AF,
-                                     0x10B0, 0x10B1, 0x10B2, 0x10B3, 0x10B4, 0x10B5, 0x10B6, 0x10B7, 0x10B8, 0x10B9, 0x10BA, 0x10BB, 0x10BC, 0x10BD, 0x10BE, 0x10BF,
-                                     0x10C0, 0x10C1, 0x10C2, 0x10C3, 0x10C4, 0x10C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 title_data38[]  = { 0x0000, 0xA640, 0x0000, 0xA642, 0x0000, 0xA644, 0x0000, 0xA646, 0x0000, 0xA648, 0x0000, 0xA64A, 0x0000, 0xA64C, 0x0000, 0xA64E,
-                                     0x0000, 0xA650, 0x0000, 0xA652, 0x0000, 0xA654, 0x0000, 0xA656, 0x0000, 0xA658, 0x0000, 0xA65A, 0x0000, 0xA65C, 0x0000, 0xA65E,
-                                     0x0000, 0x0000, 0x0000, 0xA662, 0x0000, 0xA664, 0x0000, 0xA666, 0x0000, 0xA668, 0x0000, 0xA66A, 0x0000, 0xA66C, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 title_data39[]  = { 0x0000, 0xA680, 0x0000, 0xA682, 0x0000, 0xA684, 0x0000, 0xA686, 0x0000, 0xA688, 0x0000, 0xA68A, 0x0000, 0xA68C, 0x0000, 0xA68E,
-                                     0x0000, 0xA690, 0x0000, 0xA692, 0x0000, 0xA694, 0x0000, 0xA696, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 title_data40[]  = { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0xA722, 0x0000, 0xA724, 0x0000, 0xA726, 0x0000, 0xA728, 0x0000, 0xA72A, 0x0000, 0xA72C, 0x0000, 0xA72E,
-                                     0x0000, 0x0000, 0x0000, 0xA732, 0x0000, 0xA734, 0x0000, 0xA736, 0x0000, 0xA738, 0x0000, 0xA73A, 0x0000, 0xA73C, 0x0000, 0xA73E };
-static const u16 title_data41[]  = { 0x0000, 0xA740, 0x0000, 0xA742, 0x0000, 0xA744, 0x0000, 0xA746, 0x0000, 0xA748, 0x0000, 0xA74A, 0x0000, 0xA74C, 0x0000, 0xA74E,
-                                     0x0000, 0xA750, 0x0000, 0xA752, 0x0000, 0xA754, 0x0000, 0xA756, 0x0000, 0xA758, 0x0000, 0xA75A, 0x0000, 0xA75C, 0x0000, 0xA75E,
-                                     0x0000, 0xA760, 0x0000, 0xA762, 0x0000, 0xA764, 0x0000, 0xA766, 0x0000, 0xA768, 0x0000, 0xA76A, 0x0000, 0xA76C, 0x0000, 0xA76E,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA779, 0x0000, 0xA77B, 0x0000, 0x0000, 0xA77E };
-static const u16 title_data42[]  = { 0x0000, 0xA780, 0x0000, 0xA782, 0x0000, 0xA784, 0x0000, 0xA786, 0x0000, 0x0000, 0x0000, 0x0000, 0xA78B, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-static const u16 title_data43[]  = { 0x0000, 0xFF21, 0xFF22, 0xFF23, 0xFF24, 0xFF25, 0xFF26, 0xFF27, 0xFF28, 0xFF29, 0xFF2A, 0xFF2B, 0xFF2C, 0xFF2D, 0xFF2E, 0xFF2F,
-                                     0xFF30, 0xFF31, 0xFF32, 0xFF33, 0xFF34, 0xFF35, 0xFF36, 0xFF37, 0xFF38, 0xFF39, 0xFF3A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-                                     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
-
-static const u16 *title_data_table[TITLE_BLOCK_COUNT] = {
-title_data0,title_data1,title_data2,title_data3,title_data4,title_data5,title_data6,title_data7,title_data8,title_data9,
-title_data10,title_data11,title_data12,title_data13,title_data14,title_data15,title_data16,title_data17,title_data18,title_data19,
-title_data20,title_data21,title_data22,title_data23,title_data24,title_data25,title_data26,title_data27,title_data28,title_data29,
-title_data30,title_data31,title_data32,title_data33,title_data34,title_data35,title_data36,title_data37,title_data38,title_data39,
-title_data40,title_data41,title_data42,title_data43
-};
-/* Generated by JcD. Do not modify. End title_tables */
 
 SQLITE_PRIVATE u32 unifuzz_title(
     u32 c
 ){
-    u32 p;
-    if (c >= 0x10000) return c;
-    p = (title_data_table[title_indexes[(c) >> TITLE_BLOCK_SHIFT]][(c) & TITLE_BLOCK_MASK]);
-    return (p == 0) ? c : p;
+    return PROPS_MAP(c, unifuzz_props(c, 0)->title);
 }
 
 
-SQLITE_PRIVATE const u8 hexdigits[] = "0123456789ABCDEF";
+/*
+** 64-bit FNV-1a of the n bytes at p, from h: the checksum of table files,
+** and the collation fingerprint
+*/
+#define FINGERPRINT_BASIS   0xCBF29CE484222325ULL
+#define FINGERPRINT_PRIME   0x00000100000001B3ULL
 
+SQLITE_PRIVATE sqlite3_uint64 fingerprint_add(
+    sqlite3_uint64 h,
+    const void *p,
+    int n
+){
+    const u8 *z = (const u8 *) p;
+    int i;
+    for (i = 0; i < n; i++) {
+        h = (h ^ z[i]) * FINGERPRINT_PRIME;
+    }
+    return h;
+}
 
 /*
-** Structure used to store the codepoint ranges for whitespaces and
-** control characters (some are not actual whitespaces)
-** but it's extremely unlikely that this could cause any toxic behavior.
-** The table must be sorted on increasing range start point.
+** Case and accent table files
+**
+** tools/mktables -o writes the arrays of the table of unifuzz_tables.h to a
+** file, after a PropsFileHeaderT, at offsets from the start of the file: it
+** is read where it is mapped, read-only, and the page cache holds a single
+** copy for all the processes of the host.  Upgrading the mappings is then a
+** matter of shipping a file.  The first connection to load the extension
+** maps the file named by the UNIFUZZ_TABLES environment variable, else by
+** UNIFUZZ_TABLES_FILE when defined at compile time, and the process keeps
+** it until it exits.  A file that can't be mapped, of another format, byte
+** order or layout, with a wrong checksum or fingerprint or a number out of
+** its arrays is logged with sqlite3_log() and the compiled tables are kept.
 */
-typedef struct spacing_ {
-    u32 lo;
-    u32 hi;
-} SpacingT;
+#define PROPS_FILE_MAGIC        "UFZPROPS"
+#define PROPS_FILE_VERSION      1
+#define PROPS_FILE_ARRAYS       6
+#define PROPS_FILE_MAX_SIZE     (1 << 24)
+
+typedef struct propsFileHeader_ {
+    char zMagic[8];                     /* PROPS_FILE_MAGIC, unterminated */
+    sqlite3_uint64 checksum;            /* FNV-1a of the rest of the file */
+    sqlite3_uint64 fingerprint;         /* PROPS_FINGERPRINT of its mappings */
+    u32 version;                        /* PROPS_FILE_VERSION */
+    u32 byteOrder;                      /* 0x01020304 as written */
+    u32 size;                           /* of the file */
+    u8 blockShift;                      /* the layout, that of the compiled table */
+    u8 spanShift;
+    u8 spanBits;                        /* widths of PropsSpanT and PropsIdT */
+    u8 idBits;
+    u32 spansSize;                      /* numbers of entries of the arrays */
+    u32 spanCount;
+    u32 blockCount;
+    u32 recordCount;
+    u32 dataSize;
+    u32 astralCount;
+    u32 astralMask;
+    u32 aOffset[PROPS_FILE_ARRAYS];     /* spans, indexes, blocks, records, unacc, astral */
+    u32 reserved;
+} PropsFileHeaderT;
+
+static int props_loaded = 0;
+static char props_source[512] = "compiled";    /* for unifuzz_tables() */
 
-SQLITE_PRIVATE SpacingT space_table[] = {
-    {0x000000, 0x000020},   // control characters, most are unlikely
-    {0x000080, 0x0000A0},   // control characters, other set also most unlikely
-    {0x001680, 0x001680},	// Ogham sp mark
-    {0x00180E, 0x00180E},	// Mongolian vowel separator
-    {0x002000, 0x00200A},	// En quad, Em quad, En sp, Em sp, 3/em sp, 4/em sp, 6/em sp, Figure sp, Punctuation sp, Thin sp, Hair sp,
-    {0x002028, 0x002029},	// Line separator, Paragraph separator
-    {0x00205F, 0x00205F},	// Medium mathematical sp
-    {0x003000, 0x003000},	// Ideographic sp
-    {0x00FEFF, 0x00FEFF},   // BOM
-    {0xFFFFFF, 0xFFFFFF}    // end of table
-};
+/*
+** Maps the file zFile read-only, at *ppMap for *pnSize bytes.  Returns an
+** error message, 0 if mapped.
+*/
+SQLITE_PRIVATE const char *props_file_map(
+    const char *zFile,
+    const u8 **ppMap,
+    sqlite3_int64 *pnSize
+){
+#if defined(_WIN32)
+    HANDLE hFile, hMap;
+    LARGE_INTEGER size;
+    void *pMap = 0;
+
+    hFile = CreateFileA(zFile, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+    if (hFile == INVALID_HANDLE_VALUE) return "cannot open";
+    if (GetFileSizeEx(hFile, &size) && (size.QuadPart > 0) && (size.QuadPart <= PROPS_FILE_MAX_SIZE)) {
+        hMap = CreateFileMappingA(hFile, 0, PAGE_READONLY, 0, 0, 0);
+        if (hMap) {
+            pMap = MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(hMap);
+        }
+    }
+    CloseHandle(hFile);
+    if (pMap == 0) return "cannot map";
+    *pnSize = size.QuadPart;
+#else
+    struct stat st;
+    void *pMap = MAP_FAILED;
+    int fd = open(zFile, O_RDONLY);
+
+    if (fd < 0) return "cannot open";
+    if ((fstat(fd, &st) == 0) && (st.st_size > 0) && (st.st_size <= PROPS_FILE_MAX_SIZE)) {
+        pMap = mmap(0, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (pMap == MAP_FAILED) return "cannot map";
+    *pnSize = st.st_size;
+#endif
+    *ppMap = (const u8 *) pMap;
+    return 0;
+}
+
+SQLITE_PRIVATE void props_file_unmap(
+    const u8 *pMap,
+    sqlite3_int64 nMap
+){
+#if defined(_WIN32)
+    UNUSED_PARAMETER(nMap);
+    UnmapViewOfFile(pMap);
+#else
+    munmap((void *) pMap, (size_t) nMap);
+#endif
+}
+
+/*
+** Fingerprint of the mappings of the tables p, as tools/mktables computes
+** it: FNV-1a of the fold, lower, upper and title mappings of every code
+** point, then the length and code points of its expansion, as little endian
+** 32 bit numbers.  The lookups of unifuzz_props(), on p.
+*/
+SQLITE_PRIVATE sqlite3_uint64 props_fingerprint(
+    const PropsTablesT *p
+){
+    const CodePropsIndexT *pIndex;
+    const CodePropsT *pRecord;
+    const u16 *pUnacc;
+    sqlite3_uint64 h = FINGERPRINT_BASIS;
+    u32 c, span, a[4 + 1 + 255];
+    u8 z[sizeof(a)];
+    int i, k, n;
+
+    for (c = 0; c <= 0x10FFFF; c++) {
+        span = c >> (PROPS_BLOCK_SHIFT + PROPS_SPAN_SHIFT);
+        span = (span < PROPS_SPANS_SIZE - 1) ? span : PROPS_SPANS_SIZE - 1;
+        pIndex = &p->indexes[((u32) p->spans[span] << PROPS_SPAN_SHIFT) | ((c >> PROPS_BLOCK_SHIFT) & PROPS_SPAN_MASK)];
+        pRecord = &p->records[p->blocks[((u32) pIndex->block << PROPS_BLOCK_SHIFT) | (c & PROPS_BLOCK_MASK)]];
+        pUnacc = &p->unacc[(u16) (pIndex->unacc + pRecord->unacc)];
+        a[0] = PROPS_MAP(c, pRecord->fold);
+        a[1] = PROPS_MAP(c, pRecord->lower);
+        a[2] = PROPS_MAP(c, pRecord->upper);
+        a[3] = PROPS_MAP(c, pRecord->title);
+        a[4] = pRecord->unaccLength;
+        n = 5;
+        for (k = 0; k < pRecord->unaccLength; k++) {
+            a[n++] = ((u16) (pUnacc[k] - UNACC_ESCAPE) < p->astralCount)
+                ? p->astral[(pUnacc[k] - UNACC_ESCAPE) & p->astralMask] : (u32) pUnacc[k];
+        }
+        for (i = 0; i < n; i++) {
+            z[4 * i] = (u8) a[i];
+            z[4 * i + 1] = (u8) (a[i] >> 8);
+            z[4 * i + 2] = (u8) (a[i] >> 16);
+            z[4 * i + 3] = (u8) (a[i] >> 24);
+        }
+        h = fingerprint_add(h, z, 4 * n);
+    }
+    return h;
+}
+
+/*
+** Points *p at the arrays of the table file z of n bytes, after checking
+** its header and checksum, that every number it holds stays within the
+** array it indexes (the lookups don't check any), and that its mappings
+** have the fingerprint of its header: the checksum only tells that the
+** file is whole.  Returns an error message, 0 if the file can be used.
+*/
+SQLITE_PRIVATE const char *props_file_check(
+    const u8 *z,
+    sqlite3_int64 n,
+    PropsTablesT *p
+){
+    const PropsFileHeaderT *h = (const PropsFileHeaderT *) z;
+    const CodePropsIndexT *pIndex;
+    const CodePropsT *pRecord;
+    sqlite3_int64 aSize[PROPS_FILE_ARRAYS];
+    u32 i, k, at;
+
+    if ((n < (sqlite3_int64) sizeof(*h)) || (memcmp(h->zMagic, PROPS_FILE_MAGIC, sizeof(h->zMagic)) != 0)) {
+        return "not a table file";
+    }
+    if (h->byteOrder != 0x01020304) return "of another byte order";
+    if (h->version != PROPS_FILE_VERSION) return "of another format version";
+    if (h->size != n) return "truncated";
+    if ((h->blockShift != PROPS_BLOCK_SHIFT) || (h->spanShift != PROPS_SPAN_SHIFT)
+        || (h->spanBits != 8 * sizeof(PropsSpanT)) || (h->idBits != 8 * sizeof(PropsIdT))
+        || (h->spansSize != PROPS_SPANS_SIZE)) {
+        return "of another layout";
+    }
+    // escapes are surrogates, offsets 16 bits
+    if ((h->spanCount == 0) || (h->blockCount == 0) || (h->recordCount == 0)
+        || (h->dataSize == 0) || (h->dataSize > 0x10000)
+        || (h->astralMask >= 0x800) || (h->astralMask & (h->astralMask + 1)) || (h->astralCount > h->astralMask + 1)) {
+        return "of bad sizes";
+    }
+    aSize[0] = (sqlite3_int64) h->spansSize * sizeof(PropsSpanT);
+    aSize[1] = ((sqlite3_int64) h->spanCount << PROPS_SPAN_SHIFT) * sizeof(CodePropsIndexT);
+    aSize[2] = ((sqlite3_int64) h->blockCount << PROPS_BLOCK_SHIFT) * sizeof(PropsIdT);
+    aSize[3] = (sqlite3_int64) h->recordCount * sizeof(CodePropsT);
+    aSize[4] = (sqlite3_int64) h->dataSize * sizeof(u16);
+    aSize[5] = ((sqlite3_int64) h->astralMask + 1) * sizeof(u32);
+    for (i = 0; i < PROPS_FILE_ARRAYS; i++) {
+        if ((h->aOffset[i] < sizeof(*h)) || (h->aOffset[i] & 7) || (h->aOffset[i] + aSize[i] > n)) {
+            return "truncated";
+        }
+    }
+    at = sizeof(h->zMagic) + sizeof(h->checksum);
+    if (fingerprint_add(FINGERPRINT_BASIS, z + at, (int) (n - at)) != h->checksum) return "of bad checksum";
+
+    p->spans = (const PropsSpanT *) (z + h->aOffset[0]);
+    p->indexes = (const CodePropsIndexT *) (z + h->aOffset[1]);
+    p->blocks = (const PropsIdT *) (z + h->aOffset[2]);
+    p->records = (const CodePropsT *) (z + h->aOffset[3]);
+    p->unacc = (const u16 *) (z + h->aOffset[4]);
+    p->astral = (const u32 *) (z + h->aOffset[5]);
+    p->astralCount = h->astralCount;
+    p->astralMask = h->astralMask;
+    p->fingerprint = h->fingerprint;
+
+    for (i = 0; i < h->spansSize; i++) {
+        if (p->spans[i] >= h->spanCount) return "of bad spans";
+    }
+    for (i = 0; i < (h->blockCount << PROPS_BLOCK_SHIFT); i++) {
+        if (p->blocks[i] >= h->recordCount) return "of bad record numbers";
+    }
+    for (i = 0; i < (h->spanCount << PROPS_SPAN_SHIFT); i++) {
+        pIndex = &p->indexes[i];
+        if (pIndex->block >= h->blockCount) return "of bad blocks";
+        for (k = 0; k <= PROPS_BLOCK_MASK; k++) {
+            pRecord = &p->records[p->blocks[((u32) pIndex->block << PROPS_BLOCK_SHIFT) | k]];
+            if (((u32) (u16) (pIndex->unacc + pRecord->unacc) + pRecord->unaccLength > h->dataSize)
+                || ((u32) (u16) (pIndex->unacc + pRecord->foldUnacc) + pRecord->foldUnaccLength > h->dataSize)) {
+                return "of bad expansions";
+            }
+        }
+    }
+    if (props_fingerprint(p) != h->fingerprint) return "of a wrong fingerprint";
+    return 0;
+}
+
+/*
+** Maps the table file configured, if any, in place of the compiled tables,
+** once per process
+*/
+SQLITE_PRIVATE void props_load(void){
+    sqlite3_mutex *mutex = sqlite3_mutex_alloc(SQLITE_MUTEX_STATIC_MASTER);
+    PropsTablesT tables = props_tables;
+    const char *zFile, *zError;
+    const u8 *pMap = 0;
+    sqlite3_int64 nMap = 0;
+
+    sqlite3_mutex_enter(mutex);
+    if (!props_loaded) {
+        zFile = getenv("UNIFUZZ_TABLES");
+#ifdef UNIFUZZ_TABLES_FILE
+        if (zFile == 0) zFile = UNIFUZZ_TABLES_FILE;
+#endif
+        if (zFile && zFile[0]) {
+            zError = props_file_map(zFile, &pMap, &nMap);
+            if ((zError == 0) && ((zError = props_file_check(pMap, nMap, &tables)) != 0)) {
+                props_file_unmap(pMap, nMap);
+            }
+            if (zError) {
+                sqlite3_log(SQLITE_WARNING, "unifuzz: table file %s %s, the compiled tables are used", zFile, zError);
+                sqlite3_snprintf(sizeof(props_source), props_source, "compiled (%s %s)", zFile, zError);
+            } else {
+                props_tables = tables;
+                sqlite3_snprintf(sizeof(props_source), props_source, "%s", zFile);
+            }
+        }
+        props_loaded = 1;
+    }
+    sqlite3_mutex_leave(mutex);
+}
+
+/*
+** unifuzz_tables() returns the fingerprint of the case and accent tables in
+** use as 16 hexadecimal digits, then the table file they are mapped from,
+** or "compiled"
+*/
+SQLITE_PRIVATE void tablesFunc(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
+){
+    char *z;
+    UNUSED_PARAMETER(argc);
+    UNUSED_PARAMETER(argv);
+    z = sqlite3_mprintf("%016llx %s", props_tables.fingerprint, props_source);
+    if (z == 0) {
+        sqlite3_result_error_nomem(context);
+        return;
+    }
+    sqlite3_result_text(context, z, -1, sqlite3_free);
+}
+
+
+SQLITE_PRIVATE const u8 hexdigits[] = "0123456789ABCDEF";
 
 
 /*
@@ -2896,6 +1565,44 @@ assert(esc == 0);    /* This only occurs for GLOB, not LIKE */
 }
 
 
+/*
+** Soundex code of the folded unaccented string z of n characters into
+** zOut (5 bytes): the first letter, then the digits of the consonants
+** that follow, adjacent consonants of the same digit counting once, even
+** across H and W.  Vowels separate them; anything else but ASCII letters
+** is skipped.  Padded with '0' to 4 characters, empty if z has no letter.
+*/
+SQLITE_PRIVATE void unifuzz_soundex(
+    const u32 *z,
+    int n,
+    char *zOut
+){
+    static const char codes[] = "01230120022455012623010202";   /* a .. z, 0 for vowels, H, W and Y */
+    int i, k = 0;
+    char last = 0, d;
+    u32 c;
+
+    for (i = 0; (i < n) && (k < 4); i++) {
+        c = z[i];
+        if ((c >= 'A') && (c <= 'Z')) c += 'a' - 'A';
+        if ((c < 'a') || (c > 'z')) continue;
+        d = codes[c - 'a'];
+        if (k == 0) {
+            zOut[k++] = (char) (c - 'a' + 'A');
+        } else if ((d != '0') && (d != last)) {
+            zOut[k++] = d;
+        }
+        if ((d != '0') || ((c != 'h') && (c != 'w'))) {
+            last = d;
+        }
+    }
+    if (k > 0) {
+        while (k < 4) zOut[k++] = '0';
+    }
+    zOut[k] = 0;
+}
+
+
 #define UNIFUZZ_MAX_PRINTF_ARGS     32
 
 SQLITE_PRIVATE void printfFunc(
@@ -3063,7 +1770,8 @@ SQLITE_PRIVATE u8 *unifuzz_utf8_unacc_utf8(
     int *outBytes
 ){
     int l, k, outalloc, outbytesleft;
-    u32 c, *uac;
+    u32 c;
+    const u16 *uac;
     u8 *p, *term, *outStr, *q, *q0;
 
     // UTF-8 should be no longer than UTF-8, but unaccent may need more
@@ -3090,7 +1798,8 @@ SQLITE_PRIVATE u8 *unifuzz_utf8_unacc_utf8(
                     q0 = q;
                 }
                 for (k = 0; k < l; k++, uac++) {
-                    WRITE_UTF8(q, *uac)      // we do not know how many u8 will be written
+                    c = UNACC_CODE(*uac);
+                    WRITE_UTF8(q, c)         // we do not know how many u8 will be written
                 }
             } else {
                 WRITE_UTF8(q, c)
@@ -3120,7 +1829,8 @@ SQLITE_PRIVATE u32 *unifuzz_utf8_unacc_utf32(
 ){
     int l, k, outalloc, used;
     u8 *p, *term;
-    u32 c, *uac, *outStr, *q;
+    u32 c, *outStr, *q;
+    const u16 *uac;
 
     // UTF-32 will be 4 times as long as character-wise input, but unaccent can need more.
     //
@@ -3146,8 +1856,9 @@ SQLITE_PRIVATE u32 *unifuzz_utf8_unacc_utf32(
                 c = unifuzz_unacc(c, &uac, &l);
             }
             if (l > 0) {
+                // room for the expansion, and for one code point per input unit left
                 if (l > 1) {
-                    while ((int) (outalloc - used * sizeof(u32)) < l) {
+                    while (outalloc < (used + l + (int) (term - p)) * (int) sizeof(u32)) {
                         outalloc += UNIFUZZ_CHUNK;
                         outStr = (u32 *) contextRealloc(context, outStr, outalloc + sizeof(u32));
                         if (outStr == 0) return 0;
@@ -3155,7 +1866,7 @@ SQLITE_PRIVATE u32 *unifuzz_utf8_unacc_utf32(
                     }
                 }
                 for (k = 0; k < l; k++) {
-                    *q++ = *uac++;
+                    *q++ = UNACC_CODE(uac[k]);
                     used++;
                 }
             } else {
@@ -3265,6 +1976,35 @@ SQLITE_PRIVATE void unaccFunc8(
 }
 
 
+/*
+** Implementation of the PHONETIC() SQL function: the Soundex code of the
+** folded unaccented string.
+*/
+SQLITE_PRIVATE void phoneticFunc8(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
+){
+    const u8 *z1;
+    u32 *z2;
+    int n, l;
+    char zCode[5];
+    UNUSED_PARAMETER(argc);
+    if (SQLITE_NULL == sqlite3_value_type(argv[0])) {
+        sqlite3_result_null(context);
+        return;
+    }
+    z1 = (u8 *) sqlite3_value_text(argv[0]);
+    n = sqlite3_value_bytes(argv[0]);
+    z2 = unifuzz_utf8_unacc_utf32(context, (u8 *) z1, n, &l, 1);
+    if (z2 != 0) {
+        unifuzz_soundex(z2, l, zCode);
+        sqlite3_free(z2);
+        sqlite3_result_text(context, zCode, -1, SQLITE_TRANSIENT);
+    }
+}
+
+
 /*
 ** Implementation of the FLIP() SQL function.
 ** This function is essentially a Unicode strrev(): it returns the
@@ -3387,6 +2127,7 @@ SQLITE_PRIVATE void properFunc8(
     u8 *z2, *q;
     int k, n, outalloc, outbytesleft, head;
     u32 c, up, lo;
+    const CodePropsT *pProps;
     UNUSED_PARAMETER(argc);
     if (SQLITE_NULL == sqlite3_value_type(argv[0])) {
         sqlite3_result_null(context);
@@ -3403,8 +2144,9 @@ SQLITE_PRIVATE void properFunc8(
         head = 1;
         while (*p) {
             READ_UTF8(p, term, c)
-            up = unifuzz_title(c);
-            lo = unifuzz_lower(c);
+            pProps = unifuzz_props(c, 0);
+            up = PROPS_MAP(c, pProps->title);
+            lo = PROPS_MAP(c, pProps->lower);
             if (up != lo) {                 // crude criterion for discrimating letters candidate for title case at head of word
                 if (head) {
                     c = up;                 // '' can't normally appear at the head of a word. If it does, it is written verbatim.
@@ -3982,7 +2724,8 @@ SQLITE_PRIVATE u16 *unifuzz_utf16_unacc_utf16(
     int *outBytes
 ){
     int l, k, outalloc, outU16left;
-    u32 c, *uac;
+    u32 c;
+    const u16 *uac;
     u16 *p, *term, *outStr, *q, *q0;
 
     // UTF-16 should be no longer than UTF-16, but unaccent can need more
@@ -4009,7 +2752,8 @@ SQLITE_PRIVATE u16 *unifuzz_utf16_unacc_utf16(
                     q0 = q;
                 }
                 for (k = 0; k < l; k++, uac++) {
-                    WRITE_UTF16(q, *uac)       // we do not know how many u16 will be written
+                    c = UNACC_CODE(*uac);
+                    WRITE_UTF16(q, c)          // we do not know how many u16 will be written
                 }
             } else {
                 WRITE_UTF16(q, c)
@@ -4039,7 +2783,8 @@ SQLITE_PRIVATE u32 *unifuzz_utf16_unacc_utf32(
 ){
     int l, k, outalloc, used;
     u16 *p, *term;
-    u32 c, *uac, *outStr, *q;
+    u32 c, *outStr, *q;
+    const u16 *uac;
 
     // UTF-32 will be 4 times as long than character-wise input, but unaccent can need more
     //
@@ -4065,8 +2810,9 @@ SQLITE_PRIVATE u32 *unifuzz_utf16_unacc_utf32(
                 c = unifuzz_unacc(c, &uac, &l);
             }
             if (l > 0) {
+                // room for the expansion, and for one code point per input unit left
                 if (l > 1) {
-                    while ((int) (outalloc - used * sizeof(u32)) < l) {
+                    while (outalloc < (used + l + (int) (term - p)) * (int) sizeof(u32)) {
                         outalloc += UNIFUZZ_CHUNK;
                         outStr = (u32 *) contextRealloc(context, outStr, outalloc + sizeof(u32));
                         if (outStr == 0) return 0;
@@ -4074,7 +2820,7 @@ SQLITE_PRIVATE u32 *unifuzz_utf16_unacc_utf32(
                     }
                 }
                 for (k = 0; k < l; k++) {
-                    *q++ = *uac++;
+                    *q++ = UNACC_CODE(uac[k]);
                     used++;
                 }
             } else {
@@ -4184,6 +2930,35 @@ SQLITE_PRIVATE void unaccFunc16(
 }
 
 
+/*
+** Implementation of the PHONETIC() SQL function: the Soundex code of the
+** folded unaccented string.
+*/
+SQLITE_PRIVATE void phoneticFunc16(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
+){
+    const u16 *z1;
+    u32 *z2;
+    int n, l;
+    char zCode[5];
+    UNUSED_PARAMETER(argc);
+    if (SQLITE_NULL == sqlite3_value_type(argv[0])) {
+        sqlite3_result_null(context);
+        return;
+    }
+    z1 = (u16 *) sqlite3_value_text16(argv[0]);
+    n = sqlite3_value_bytes16(argv[0]);
+    z2 = unifuzz_utf16_unacc_utf32(context, (u16 *) z1, n, &l, 1);
+    if (z2 != 0) {
+        unifuzz_soundex(z2, l, zCode);
+        sqlite3_free(z2);
+        sqlite3_result_text(context, zCode, -1, SQLITE_TRANSIENT);
+    }
+}
+
+
 /*
 ** Implementation of the FOLD(), LOWER(), UPPER(), TITLE()
 ** scalar SQL functions.
@@ -4313,6 +3088,7 @@ SQLITE_PRIVATE void properFunc16(
     u16 *z2, *q;
     int k, n, outalloc, outU16left, head;
     u32 c, up, lo;
+    const CodePropsT *pProps;
     UNUSED_PARAMETER(argc);
     if (SQLITE_NULL == sqlite3_value_type(argv[0])) {
         sqlite3_result_null(context);
@@ -4329,8 +3105,9 @@ SQLITE_PRIVATE void properFunc16(
         head = 1;
         while (*p) {
             READ_UTF16(p, term, c)
-            up = unifuzz_title(c);
-            lo = unifuzz_lower(c);
+            pProps = unifuzz_props(c, 0);
+            up = PROPS_MAP(c, pProps->title);
+            lo = PROPS_MAP(c, pProps->lower);
             if (up != lo) {                 // crude criterion for discrimating letters candidate for title case at head of word
                 if (head) {
                     c = up;                 // '' can't normally appear at the head of a word. If it does, it is written verbatim.
@@ -4861,6 +3638,44 @@ SQLITE_PRIVATE void typosFunc16(
 
 #ifndef NO_WINDOWS_COLLATION
 
+/*
+** The collations compare their keys with the kernel below, on the Wine
+** collation weights embedded at build time (see unifuzz_weights.h): they
+** need no system call and order strings identically on every platform, so
+** that an index built on one is valid on all the others.  They are
+** registered for UTF-8 as well so that UTF-8 keys are compared as they are,
+** instead of having SQLite convert both keys to UTF-16 for every compare.
+**
+** Define NO_UTF8_COLLATION to only register the UTF-16LE collations.
+*/
+#if !defined(NO_UTF8_COLLATION) && (defined(UNIFUZZ_UTF8) || defined(UNIFUZZ_UTF_BOTH))
+# define UNIFUZZ_UTF8_COLLATION
+#endif
+
+/*
+** Structure used to store the codepoint ranges for whitespaces and
+** control characters (some are not actual whitespaces)
+** but it's extremely unlikely that this could cause any toxic behavior.
+** The table must be sorted on increasing range start point.
+*/
+typedef struct spacing_ {
+    u32 lo;
+    u32 hi;
+} SpacingT;
+
+SQLITE_PRIVATE SpacingT space_table[] = {
+    {0x000000, 0x000020},   // control characters, most are unlikely
+    {0x000080, 0x0000A0},   // control characters, other set also most unlikely
+    {0x001680, 0x001680},	// Ogham sp mark
+    {0x00180E, 0x00180E},	// Mongolian vowel separator
+    {0x002000, 0x00200A},	// En quad, Em quad, En sp, Em sp, 3/em sp, 4/em sp, 6/em sp, Figure sp, Punctuation sp, Thin sp, Hair sp,
+    {0x002028, 0x002029},	// Line separator, Paragraph separator
+    {0x00205F, 0x00205F},	// Medium mathematical sp
+    {0x003000, 0x003000},	// Ideographic sp
+    {0x00FEFF, 0x00FEFF},   // BOM
+    {0xFFFFFF, 0xFFFFFF}    // end of table
+};
+
 /*
 ** Structure used to store the codepoint for the acceptable signs.
 ** The soft-hyphen has been included as well: its exact same appearance
@@ -4953,6 +3768,85 @@ SQLITE_PRIVATE NumericT numeric_table[] = {
 };
 
 
+/*
+** Two-stage trie classifying codepoints for NUMERICS: one lookup tells
+** whether a codepoint is a whitespace, a sign or a digit, and which digit.
+** It is built once from the three tables above, which stay the reference,
+** by numclass_build().  Block 0 is always the one of U+0000..U+007F, so
+** that ASCII is looked up directly in numclass_data[].
+** Nothing above NUMCLASS_LIMIT is classified.  NUMCLASS() evaluates c more
+** than once.
+*/
+#define NUMCLASS_OTHER          0x00
+#define NUMCLASS_SPACE          0x01
+#define NUMCLASS_PLUS           0x02
+#define NUMCLASS_MINUS          0x03
+#define NUMCLASS_DIGIT          0x10    /* digit d is NUMCLASS_DIGIT + d */
+
+#define NUMCLASS_LIMIT          0x20000
+#define NUMCLASS_BLOCK_SHIFT    7
+#define NUMCLASS_BLOCK_SIZE     (1 << NUMCLASS_BLOCK_SHIFT)
+#define NUMCLASS_BLOCK_MASK     (NUMCLASS_BLOCK_SIZE - 1)
+#define NUMCLASS_BLOCK_COUNT    48
+#define NUMCLASS_INDEXES_SIZE   (NUMCLASS_LIMIT >> NUMCLASS_BLOCK_SHIFT)
+
+static u8 numclass_indexes[NUMCLASS_INDEXES_SIZE];
+static u8 numclass_data[NUMCLASS_BLOCK_COUNT * NUMCLASS_BLOCK_SIZE];
+static int numclass_built = 0;
+
+#define NUMCLASS(c)                                                                         \
+    (((c) < 0x80) ? numclass_data[c] :                                                      \
+     ((c) < NUMCLASS_LIMIT) ? numclass_data[(numclass_indexes[(c) >> NUMCLASS_BLOCK_SHIFT]  \
+                                            << NUMCLASS_BLOCK_SHIFT) + ((c) & NUMCLASS_BLOCK_MASK)] : \
+     NUMCLASS_OTHER)
+
+/*
+** Build the trie, once per process.  Identical blocks are shared.
+*/
+SQLITE_PRIVATE void numclass_build(void){
+    sqlite3_mutex *mutex = sqlite3_mutex_alloc(SQLITE_MUTEX_STATIC_MASTER);
+    u8 block[NUMCLASS_BLOCK_SIZE];
+    u32 lo, hi, c;
+    int b, i, nBlock = 0;
+
+    sqlite3_mutex_enter(mutex);
+    if (numclass_built) {
+        sqlite3_mutex_leave(mutex);
+        return;
+    }
+    for (b = 0; b < NUMCLASS_INDEXES_SIZE; b++) {
+        lo = (u32) b << NUMCLASS_BLOCK_SHIFT;
+        hi = lo + NUMCLASS_BLOCK_MASK;
+        memset(block, NUMCLASS_OTHER, sizeof(block));
+        for (i = 0; space_table[i].lo <= hi; i++) {
+            for (c = space_table[i].lo; c <= space_table[i].hi; c++) {
+                if (c >= lo && c <= hi) block[c - lo] = NUMCLASS_SPACE;
+            }
+        }
+        for (i = 0; sign_table[i].codepoint <= hi; i++) {
+            c = sign_table[i].codepoint;
+            if (c >= lo) block[c - lo] = (sign_table[i].sign < 0) ? NUMCLASS_MINUS : NUMCLASS_PLUS;
+        }
+        for (i = 0; numeric_table[i].lo <= hi; i++) {
+            for (c = numeric_table[i].lo; c <= numeric_table[i].hi; c++) {
+                if (c >= lo && c <= hi) block[c - lo] = (u8) (NUMCLASS_DIGIT + numeric_table[i].digit + (c - numeric_table[i].lo));
+            }
+        }
+        for (i = 0; i < nBlock; i++) {
+            if (memcmp(&numclass_data[i << NUMCLASS_BLOCK_SHIFT], block, sizeof(block)) == 0) break;
+        }
+        if (i == nBlock) {
+            assert(nBlock < NUMCLASS_BLOCK_COUNT);
+            memcpy(&numclass_data[i << NUMCLASS_BLOCK_SHIFT], block, sizeof(block));
+            nBlock++;
+        }
+        numclass_indexes[b] = (u8) i;
+    }
+    numclass_built = 1;
+    sqlite3_mutex_leave(mutex);
+}
+
+
 /*
 ** str is a UTF-16 encoded unicode string. Returns the number of Unicode
 ** characters in the first nByte of str (or up to the first 0x0000, whichever
@@ -4977,384 +3871,3794 @@ SQLITE_PRIVATE int Utf16CharLen(const u16 *str, int nByte){
 }
 
 
+#ifdef UNIFUZZ_UTF8_COLLATION
 /*
-** The built-in collating sequence NOCASE is extended to accomodate the
-** Unicode case folding mapping tables to normalize characters to their
-** fold equivalents and test them for equality.
-**
-** This collation uses a Windows function, UTF-16LE is mandatory
+** str is a UTF-8 encoded unicode string. Returns the number of Unicode
+** characters in the first nByte of str (or up to the first 0x00, whichever
+** comes first).  Characters are delimited exactly like READ_UTF8 does.
 */
-
-#ifndef LOCALE_INVARIANT
-# define LOCALE_INVARIANT 0x007F
+SQLITE_PRIVATE int Utf8CharLen(const u8 *str, int nByte){
+    int r = 0;
+    const u8 *zTerm;
+    zTerm = &str[nByte];
+    while ((str < zTerm) && (*str != 0)) {
+        if (*str++ >= 0xC0) {
+            while ((str < zTerm) && ((*str & 0xC0) == 0x80)) {
+                str++;
+            }
+        }
+        r++;
+    }
+    return r;
+}
 #endif
 
-SQLITE_PRIVATE int nocase_collate(
-    void *encoding,
-    int nKey1,
+
+/*
+** The compare kernel below is instantiated for every collation and
+** encoding: make sure it gets inlined.
+*/
+#if defined(__GNUC__)
+# define UNIFUZZ_INLINE static inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+# define UNIFUZZ_INLINE static __forceinline
+#else
+# define UNIFUZZ_INLINE static inline
+#endif
+
+
+/*
+** Sequential reader handing out the UTF-16 code units of a collation key:
+** UTF-16 keys as they are, UTF-8 keys the same way SQLite would have
+** converted them to UTF-16 (invalid sequences become U+FFFD and
+** supplementary characters become a surrogate pair).
+**
+** The collations have always compared the first Utf16CharLen() code units
+** of their keys.  That is every code unit up to the first null, unless a
+** lead surrogate comes first: Utf16CharLen() counts it and the code unit
+** after it as a single character, so fewer code units are compared.  The
+** reader thus simply stops at the first null or at the end of the key, in
+** the same pass as the compare.  Only when it meets a lead surrogate does
+** it work out the exact count of code units left, and counts them down.
+*/
+typedef struct collUnits_ {
+    const void *pKey;       /* the whole key */
+    int nKey;               /* size of the whole key in bytes */
+    const u16 *w;           /* UTF-16: current code unit */
+    const u16 *wTerm;       /* UTF-16: first code unit past the key */
+    const u8 *z;            /* UTF-8: next byte to decode */
+    const u8 *zChar;        /* UTF-8: first byte of the current character */
+    const u8 *zTerm;        /* UTF-8: first byte past the key */
+    int n;                  /* 0 at the end, else code units left including c once counted */
+    int counted;            /* 1 once a lead surrogate fixed the count of code units */
+    u16 c;                  /* current code unit, valid when n > 0 */
+    u16 low;                /* UTF-8: low surrogate following c, 0 if none */
+} CollUnitsT;
+
+UNIFUZZ_INLINE void utf8_units_load(CollUnitsT *p){
+    u32 c;
+    if (p->low) {
+        p->c = p->low;
+        p->low = 0;
+        return;
+    }
+    p->zChar = p->z;
+    READ_UTF8(p->z, p->zTerm, c);
+    if (c > 0xFFFF) {
+        p->low = (u16) (0xDC00 + (c & 0x3FF));
+        c = 0xD800 + (((c - 0x10000) >> 10) & 0x3FF);
+    }
+    p->c = (u16) c;
+}
+
+#ifdef UNIFUZZ_UTF8_COLLATION
+/*
+** Number of code units in the first k bytes of a UTF-8 key, which must end
+** on a character boundary
+*/
+SQLITE_PRIVATE int utf8_units_before(const u8 *z, int k){
+    const u8 *zTerm = &z[k];
+    u32 c;
+    int x = 0;
+    while (z < zTerm) {
+        if (*z < 0x80) {
+            z++;
+            x++;
+        } else {
+            READ_UTF8(z, zTerm, c);
+            x += (c > 0xFFFF) ? 2 : 1;
+        }
+    }
+    return x;
+}
+#endif
+
+/*
+** The current code unit is the first lead surrogate of the key: count the
+** code units left to compare.  No code unit before it was a null or a lead
+** surrogate, so each one was a character of its own.
+*/
+SQLITE_PRIVATE void coll_units_count(CollUnitsT *p, int enc){
+    if (enc == SQLITE_UTF8) {
+#ifdef UNIFUZZ_UTF8_COLLATION
+        const u8 *z = (const u8 *) p->pKey;
+        p->n = Utf8CharLen(z, p->nKey) - utf8_units_before(z, (int) (p->zChar - z));
+#endif
+    } else {
+        p->n = Utf16CharLen((const u16 *) p->pKey, p->nKey) - (int) (p->w - (const u16 *) p->pKey);
+    }
+    p->counted = 1;
+}
+
+/*
+** Loads the code unit at the current position of a reader that hasn't met
+** a lead surrogate yet
+*/
+UNIFUZZ_INLINE void coll_units_load(CollUnitsT *p, int enc){
+    if (enc == SQLITE_UTF8) {
+        if ((p->z >= p->zTerm) || (*p->z == 0)) {
+            p->n = 0;
+            return;
+        }
+        utf8_units_load(p);
+        if (p->low) coll_units_count(p, enc);
+        return;
+    }
+    if ((p->w >= p->wTerm) || (*p->w == 0)) {
+        p->n = 0;
+        return;
+    }
+    p->c = *p->w;
+    if ((u16) (p->c - 0xD800) < 0x500) coll_units_count(p, enc);
+}
+
+/*
+** Starts reading the key at byte (UTF-8) or code unit (UTF-16) k, which
+** starts a character.  No null or lead surrogate may come before k.
+*/
+UNIFUZZ_INLINE void coll_units_start(CollUnitsT *p, int enc, const void *pKey, int nKey, int k){
+    p->pKey = pKey;
+    p->nKey = nKey;
+    p->n = 1;
+    p->counted = 0;
+    p->c = 0;
+    if (enc == SQLITE_UTF8) {
+        p->z = &((const u8 *) pKey)[k];
+        p->zTerm = &((const u8 *) pKey)[nKey];
+        p->low = 0;
+    } else {
+        p->w = &((const u16 *) pKey)[k];
+        p->wTerm = &((const u16 *) pKey)[nKey / sizeof(u16)];
+    }
+    coll_units_load(p, enc);
+}
+
+UNIFUZZ_INLINE void coll_units_next(CollUnitsT *p, int enc){
+    if (!p->counted) {
+        if (enc != SQLITE_UTF8) p->w++;
+        coll_units_load(p, enc);
+    } else if (--p->n > 0) {
+        if (enc == SQLITE_UTF8) {
+            utf8_units_load(p);
+        } else {
+            p->c = *++p->w;
+        }
+    }
+}
+
+
+/*
+** Collation element of a UTF-16 code unit: unicode weight in the high 16 bits,
+** diacritic weight in the next 8 bits, case weight in the next 4 bits.
+**
+** The elements come from unifuzz_weights.h, which the Makefile generates
+** with tools/mkweights: the Wine collation_table and the symbol test of its
+** get_char_typeW() flattened into one direct-indexed entry per code unit,
+** so that each code unit costs a single load.
+*/
+#include "unifuzz_weights.h"
+
+#define COLLATION_ELEMENT(c)            (coll_weights[c])
+#define HAS_COLLATION_ELEMENTS(ce1, ce2) (!(((ce1) | (ce2)) & COLL_NO_ELEMENT))
+#define IS_IGNORED_SYMBOL(ce, c)        ((ce) & COLL_SYMBOL)
+
+
+/*
+** Common prefix and ASCII fast path
+**
+** Index pages and equality probes compare many keys that share a long
+** prefix, or are identical.  Identical code units have identical weights,
+** and two ASCII code units have the same collation weights exactly when they
+** are equal up to case (except control characters, which all weigh 0).  So
+** the kernel starts by skipping the longest prefix of code units that are
+** identical, or ASCII and equal up to case, 16 or 32 code units at a time
+** with SSE2 or AVX2, 8 bytes at a time otherwise.  When the first differing
+** code units are both ASCII, their unicode weights below usually settle the
+** compare at once.
+**
+** Resuming the compare after the prefix is exact: the Wine table has one
+** collation element per code unit (no contractions or expansions), and both
+** walks skip the very same ignorable symbols within the prefix.  A UTF-8 key
+** only has to back up to the start of the character holding the first
+** differing byte.  The prefix stops short of any null and any lead
+** surrogate, which the readers above have to see (in UTF-8, a character
+** decodes beyond the BMP only after three continuation bytes in a row).
+**
+** ascii_weights[] holds the unicode weights of U+0000..U+007F in the Wine
+** collation table.
+*/
+static const u16 ascii_weights[128] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0201, 0x0202, 0x0203, 0x0204, 0x0205, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0209, 0x024b, 0x0270, 0x02a9, 0x09e0, 0x02aa, 0x02a7, 0x0269,
+    0x027a, 0x027b, 0x02a2, 0x039f, 0x022d, 0x0221, 0x0255, 0x02a4,
+    0x0a0b, 0x0a0c, 0x0a0d, 0x0a0e, 0x0a0f, 0x0a10, 0x0a11, 0x0a12,
+    0x0a13, 0x0a14, 0x0237, 0x0235, 0x03a3, 0x03a4, 0x03a5, 0x024e,
+    0x02a1, 0x0a15, 0x0a29, 0x0a3d, 0x0a49, 0x0a65, 0x0a91, 0x0a99,
+    0x0ab9, 0x0ad3, 0x0ae7, 0x0af7, 0x0b03, 0x0b2b, 0x0b33, 0x0b4b,
+    0x0b67, 0x0b73, 0x0b7f, 0x0ba7, 0x0bbf, 0x0bd7, 0x0bef, 0x0bfb,
+    0x0c03, 0x0c07, 0x0c13, 0x027c, 0x02a6, 0x027d, 0x020f, 0x021b,
+    0x020c, 0x0a15, 0x0a29, 0x0a3d, 0x0a49, 0x0a65, 0x0a91, 0x0a99,
+    0x0ab9, 0x0ad3, 0x0ae7, 0x0af7, 0x0b03, 0x0b2b, 0x0b33, 0x0b4b,
+    0x0b67, 0x0b73, 0x0b7f, 0x0ba7, 0x0bbf, 0x0bd7, 0x0bef, 0x0bfb,
+    0x0c03, 0x0c07, 0x0c13, 0x027e, 0x03a7, 0x027f, 0x03aa, 0x0000
+};
+
+#define ASCII_LOWER(c)      ((((c) >= 'A') && ((c) <= 'Z')) ? ((c) | 0x20) : (c))
+
+#if defined(__AVX2__)
+/*
+** Bit i of the result is set when code units i of a and b are identical, or
+** both ASCII and equal up to case (2 bits per code unit when wide)
+*/
+UNIFUZZ_INLINE u32 prefix_match_avx2(__m256i a, __m256i b, int wide){
+    __m256i ua, ub, lo, hi, asc, eq;
+    if (wide) {
+        eq = _mm256_cmpeq_epi16(a, b);
+        lo = _mm256_set1_epi16('A' - 1);
+        hi = _mm256_set1_epi16('Z' + 1);
+        ua = _mm256_and_si256(_mm256_cmpgt_epi16(a, lo), _mm256_cmpgt_epi16(hi, a));
+        ub = _mm256_and_si256(_mm256_cmpgt_epi16(b, lo), _mm256_cmpgt_epi16(hi, b));
+        asc = _mm256_cmpeq_epi16(_mm256_and_si256(_mm256_or_si256(a, b), _mm256_set1_epi16((short) 0xFF80)), _mm256_setzero_si256());
+        a = _mm256_or_si256(a, _mm256_and_si256(ua, _mm256_set1_epi16(0x20)));
+        b = _mm256_or_si256(b, _mm256_and_si256(ub, _mm256_set1_epi16(0x20)));
+        return (u32) _mm256_movemask_epi8(_mm256_or_si256(eq, _mm256_and_si256(asc, _mm256_cmpeq_epi16(a, b))));
+    }
+    eq = _mm256_cmpeq_epi8(a, b);
+    lo = _mm256_set1_epi8('A' - 1);
+    hi = _mm256_set1_epi8('Z' + 1);
+    ua = _mm256_and_si256(_mm256_cmpgt_epi8(a, lo), _mm256_cmpgt_epi8(hi, a));
+    ub = _mm256_and_si256(_mm256_cmpgt_epi8(b, lo), _mm256_cmpgt_epi8(hi, b));
+    a = _mm256_or_si256(a, _mm256_and_si256(ua, _mm256_set1_epi8(0x20)));
+    b = _mm256_or_si256(b, _mm256_and_si256(ub, _mm256_set1_epi8(0x20)));
+    return (u32) _mm256_movemask_epi8(eq)
+        | ((u32) _mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)) & ~(u32) _mm256_movemask_epi8(_mm256_or_si256(a, b)));
+}
+
+/*
+** Bit i of the result is set when code unit i of a must end the common
+** prefix: a null, or a lead surrogate (UTF-16) or the third continuation
+** byte in a row (UTF-8).  *cont carries the continuation flags of the last
+** two bytes of a over to the next block.
+*/
+UNIFUZZ_INLINE u32 prefix_stop_avx2(__m256i a, int wide, u64 *cont){
+    u64 c, e;
+    if (wide) {
+        /* 0xD800 <= a <= 0xDCFF, i.e. a - 0xD800 < 0x500 unsigned */
+        __m256i t = _mm256_add_epi16(a, _mm256_set1_epi16((short) 0xA800));
+        return (u32) _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi16(a, _mm256_setzero_si256()),
+                                                          _mm256_cmpgt_epi16(_mm256_set1_epi16((short) 0x8500), t)));
+    }
+    c = (u32) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(a, _mm256_set1_epi8((char) 0xC0)), _mm256_set1_epi8((char) 0x80)));
+    e = (c << 2) | *cont;
+    *cont = c >> 30;
+    return (u32) _mm256_movemask_epi8(_mm256_cmpeq_epi8(a, _mm256_setzero_si256())) | (u32) (e & (e >> 1) & (e >> 2));
+}
+#elif defined(__SSE2__)
+UNIFUZZ_INLINE u32 prefix_match_sse2(__m128i a, __m128i b, int wide){
+    __m128i ua, ub, lo, hi, asc, eq;
+    if (wide) {
+        eq = _mm_cmpeq_epi16(a, b);
+        lo = _mm_set1_epi16('A' - 1);
+        hi = _mm_set1_epi16('Z' + 1);
+        ua = _mm_and_si128(_mm_cmpgt_epi16(a, lo), _mm_cmpgt_epi16(hi, a));
+        ub = _mm_and_si128(_mm_cmpgt_epi16(b, lo), _mm_cmpgt_epi16(hi, b));
+        asc = _mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(a, b), _mm_set1_epi16((short) 0xFF80)), _mm_setzero_si128());
+        a = _mm_or_si128(a, _mm_and_si128(ua, _mm_set1_epi16(0x20)));
+        b = _mm_or_si128(b, _mm_and_si128(ub, _mm_set1_epi16(0x20)));
+        return (u32) _mm_movemask_epi8(_mm_or_si128(eq, _mm_and_si128(asc, _mm_cmpeq_epi16(a, b))));
+    }
+    eq = _mm_cmpeq_epi8(a, b);
+    lo = _mm_set1_epi8('A' - 1);
+    hi = _mm_set1_epi8('Z' + 1);
+    ua = _mm_and_si128(_mm_cmpgt_epi8(a, lo), _mm_cmpgt_epi8(hi, a));
+    ub = _mm_and_si128(_mm_cmpgt_epi8(b, lo), _mm_cmpgt_epi8(hi, b));
+    a = _mm_or_si128(a, _mm_and_si128(ua, _mm_set1_epi8(0x20)));
+    b = _mm_or_si128(b, _mm_and_si128(ub, _mm_set1_epi8(0x20)));
+    return (u32) _mm_movemask_epi8(eq)
+        | ((u32) _mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) & ~(u32) _mm_movemask_epi8(_mm_or_si128(a, b)));
+}
+
+UNIFUZZ_INLINE u32 prefix_stop_sse2(__m128i a, int wide, u64 *cont){
+    u64 c, e;
+    if (wide) {
+        __m128i t = _mm_add_epi16(a, _mm_set1_epi16((short) 0xA800));
+        return (u32) _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(a, _mm_setzero_si128()),
+                                                    _mm_cmpgt_epi16(_mm_set1_epi16((short) 0x8500), t)));
+    }
+    c = (u32) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(a, _mm_set1_epi8((char) 0xC0)), _mm_set1_epi8((char) 0x80)));
+    e = (c << 2) | *cont;
+    *cont = c >> 14;
+    return (u32) _mm_movemask_epi8(_mm_cmpeq_epi8(a, _mm_setzero_si128())) | (u32) (e & (e >> 1) & (e >> 2));
+}
+#else
+/*
+** Word-at-a-time lowercasing of 8 ASCII bytes (wide == 0) or 4 ASCII
+** UTF-16 code units (wide == 1): no lane can carry into the next one.
+*/
+UNIFUZZ_INLINE u64 ascii_lower_word(u64 x, int wide){
+    u64 ge_A, gt_Z;
+    if (wide) {
+        ge_A = x + 0x7FBF7FBF7FBF7FBFULL;       /* 0x8000 - 'A' in every lane */
+        gt_Z = x + 0x7FA57FA57FA57FA5ULL;       /* 0x8000 - 'Z' - 1 */
+        return x | (((ge_A & ~gt_Z) & 0x8000800080008000ULL) >> 10);
+    }
+    ge_A = x + 0x3F3F3F3F3F3F3F3FULL;           /* 0x80 - 'A' in every lane */
+    gt_Z = x + 0x2525252525252525ULL;           /* 0x80 - 'Z' - 1 */
+    return x | (((ge_A & ~gt_Z) & 0x8080808080808080ULL) >> 2);
+}
+#endif
+
+/*
+** Length of the longest common prefix of two keys, in code units that are
+** identical or ASCII and equal up to case, considering no more than n code
+** units (bytes for UTF-8).  The prefix stops before any null or lead
+** surrogate, and before the third of three UTF-8 continuation bytes in a row.
+*/
+#define UTF8_CONT(c)        (((c) & 0xC0) == 0x80)
+#define HAS_ZERO_BYTE(x)    (((x) - 0x0101010101010101ULL) & ~(x) & 0x8080808080808080ULL)
+#define HAS_ZERO_UNIT(x)    (((x) - 0x0001000100010001ULL) & ~(x) & 0x8000800080008000ULL)
+
+UNIFUZZ_INLINE int common_prefix(int enc, const void *pKey1, const void *pKey2, int n){
+    int i = 0;
+#if defined(__AVX2__) || defined(__SSE2__)
+    u64 cont = 0;
+#endif
+    if (enc == SQLITE_UTF8) {
+        const u8 *z1 = (const u8 *) pKey1, *z2 = (const u8 *) pKey2;
+#if defined(__AVX2__)
+        for (; i + 32 <= n; i += 32) {
+            __m256i a = _mm256_loadu_si256((const __m256i *) &z1[i]);
+            u32 m = prefix_match_avx2(a, _mm256_loadu_si256((const __m256i *) &z2[i]), 0) & ~prefix_stop_avx2(a, 0, &cont);
+            if (m != 0xFFFFFFFF) return i + __builtin_ctz(~m);
+        }
+#elif defined(__SSE2__)
+        for (; i + 16 <= n; i += 16) {
+            __m128i a = _mm_loadu_si128((const __m128i *) &z1[i]);
+            u32 m = prefix_match_sse2(a, _mm_loadu_si128((const __m128i *) &z2[i]), 0) & ~prefix_stop_sse2(a, 0, &cont);
+            if (m != 0xFFFF) return i + __builtin_ctz(~m);
+        }
+#else
+        for (; i + 8 <= n; i += 8) {
+            u64 a, b;
+            memcpy(&a, &z1[i], 8);
+            memcpy(&b, &z2[i], 8);
+            if (((a | b) & 0x8080808080808080ULL) || HAS_ZERO_BYTE(a) || (ascii_lower_word(a, 0) != ascii_lower_word(b, 0))) break;
+        }
+#endif
+        while ((i < n) && (z1[i] != 0) && !((i >= 2) && UTF8_CONT(z1[i]) && UTF8_CONT(z1[i - 1]) && UTF8_CONT(z1[i - 2]))
+               && ((z1[i] == z2[i]) || ((z1[i] < 0x80) && (z2[i] < 0x80) && (ASCII_LOWER(z1[i]) == ASCII_LOWER(z2[i]))))) i++;
+    } else {
+        const u16 *w1 = (const u16 *) pKey1, *w2 = (const u16 *) pKey2;
+#if defined(__AVX2__)
+        for (; i + 16 <= n; i += 16) {
+            __m256i a = _mm256_loadu_si256((const __m256i *) &w1[i]);
+            u32 m = prefix_match_avx2(a, _mm256_loadu_si256((const __m256i *) &w2[i]), 1) & ~prefix_stop_avx2(a, 1, &cont);
+            if (m != 0xFFFFFFFF) return i + __builtin_ctz(~m) / 2;
+        }
+#elif defined(__SSE2__)
+        for (; i + 8 <= n; i += 8) {
+            __m128i a = _mm_loadu_si128((const __m128i *) &w1[i]);
+            u32 m = prefix_match_sse2(a, _mm_loadu_si128((const __m128i *) &w2[i]), 1) & ~prefix_stop_sse2(a, 1, &cont);
+            if (m != 0xFFFF) return i + __builtin_ctz(~m) / 2;
+        }
+#else
+        for (; i + 4 <= n; i += 4) {
+            u64 a, b;
+            memcpy(&a, &w1[i], 8);
+            memcpy(&b, &w2[i], 8);
+            if (((a | b) & 0xFF80FF80FF80FF80ULL) || HAS_ZERO_UNIT(a) || (ascii_lower_word(a, 1) != ascii_lower_word(b, 1))) break;
+        }
+#endif
+        while ((i < n) && (w1[i] != 0) && ((u16) (w1[i] - 0xD800) >= 0x500)
+               && ((w1[i] == w2[i]) || ((w1[i] < 0x80) && (w2[i] < 0x80) && (ASCII_LOWER(w1[i]) == ASCII_LOWER(w2[i]))))) i++;
+    }
+    return i;
+}
+
+
+/*
+** Collation flags.  The collations reproduce CompareStringW() with the
+** LOCALE_INVARIANT locale and these Windows flags:
+**
+**      NOCASE, RMNOCASE    NORM_IGNORECASE | NORM_IGNOREWIDTH |
+**                          NORM_IGNOREKANATYPE | SORT_STRINGSORT
+**      UNACCENTED          the same plus NORM_IGNORENONSPACE
+**      NAMES               NORM_IGNORECASE | NORM_IGNORENONSPACE |
+**                          NORM_IGNORESYMBOLS | NORM_IGNOREWIDTH |
+**                          NORM_IGNOREKANATYPE
+**
+** All of them ignore case, and Wine ignores the width and kana type flags.
+** Without SORT_STRINGSORT it handles hyphen and apostrophe apart in the
+** unicode weights pass, but NAMES, the only set lacking it, skips both
+** characters as punctuation beforehand.  So only two flags are left.
+*/
+#define COLLATE_IGNORENONSPACE  0x01    /* no diacritic level */
+#define COLLATE_IGNORESYMBOLS   0x02    /* punctuation and spaces skipped */
+
+#define NOCASE_FLAGS            0
+#define UNACCENTED_FLAGS        (COLLATE_IGNORENONSPACE)
+#define NAMES_FLAGS             (COLLATE_IGNORENONSPACE | COLLATE_IGNORESYMBOLS)
+
+
+/*
+** Single pass equivalent of Wine's CompareStringW(LOCALE_INVARIANT, ...) - 2
+** with the flags of our collations.
+**
+** wine_compare_string() walks both strings once comparing unicode weights,
+** again comparing diacritic weights unless NORM_IGNORENONSPACE is set, and
+** a third time comparing case weights unless NORM_IGNORECASE is set.  Every
+** pass skips the very same code units, so one walk can compare the unicode
+** weights while remembering the first diacritic difference, which decides
+** only when all unicode weights and both lengths are equal.  Case weights
+** never matter: all our collations ignore case.
+**
+** flags and enc are constants at every call site, so the compiler gives
+** each collation and encoding its own specialized comparator.
+*/
+UNIFUZZ_INLINE int collate_units(
+    int flags,
+    int enc,
+    int nKey1,
     const void *pKey1,
     int nKey2,
     const void *pKey2
 ){
-    int l1, l2;
-    UNUSED_PARAMETER(encoding);
-    l1 = Utf16CharLen((u16 *) pKey1, nKey1);
-    l2 = Utf16CharLen((u16 *) pKey2, nKey2);
+    CollUnitsT u1, u2;
+    u32 ce1, ce2;
+    int k, diacritic = 0;
+    if ((nKey1 == nKey2) && (memcmp(pKey1, pKey2, nKey1) == 0)) {
+        return 0;
+    }
+    if (enc == SQLITE_UTF8) {
+        const u8 *z1 = (const u8 *) pKey1, *z2 = (const u8 *) pKey2;
+        k = common_prefix(enc, pKey1, pKey2, min(nKey1, nKey2));
+        while ((k > 0) && (((k < nKey1) && UTF8_CONT(z1[k])) || ((k < nKey2) && UTF8_CONT(z2[k])))) {
+            k--;
+        }
+    } else {
+        k = common_prefix(enc, pKey1, pKey2, min(nKey1, nKey2) / (int) sizeof(u16));
+    }
+    coll_units_start(&u1, enc, pKey1, nKey1, k);
+    coll_units_start(&u2, enc, pKey2, nKey2, k);
+    if ((u1.n > 0) && (u2.n > 0) && (u1.c < 0x80) && (u2.c < 0x80) && (ascii_weights[u1.c] != ascii_weights[u2.c])) {
+        if (!(flags & COLLATE_IGNORESYMBOLS)
+                || !(IS_IGNORED_SYMBOL(COLLATION_ELEMENT(u1.c), u1.c) || IS_IGNORED_SYMBOL(COLLATION_ELEMENT(u2.c), u2.c))) {
+            return (ascii_weights[u1.c] < ascii_weights[u2.c]) ? -1 : 1;
+        }
+    }
+    while ((u1.n > 0) && (u2.n > 0)) {
+        ce1 = COLLATION_ELEMENT(u1.c);
+        ce2 = COLLATION_ELEMENT(u2.c);
+        if (flags & COLLATE_IGNORESYMBOLS) {
+            int skip = 0;
+            if (IS_IGNORED_SYMBOL(ce1, u1.c)) {
+                coll_units_next(&u1, enc);
+                skip = 1;
+            }
+            if (IS_IGNORED_SYMBOL(ce2, u2.c)) {
+                coll_units_next(&u2, enc);
+                skip = 1;
+            }
+            if (skip) continue;
+        }
+        if (HAS_COLLATION_ELEMENTS(ce1, ce2)) {
+            if ((ce1 ^ ce2) >> 16) {
+                return ((ce1 >> 16) < (ce2 >> 16)) ? -1 : 1;
+            }
+            if (!(flags & COLLATE_IGNORENONSPACE) && (diacritic == 0)) {
+                diacritic = (int) ((ce1 >> 8) & 0xFF) - (int) ((ce2 >> 8) & 0xFF);
+            }
+        } else if (u1.c != u2.c) {
+            return (u1.c < u2.c) ? -1 : 1;
+        }
+        coll_units_next(&u1, enc);
+        coll_units_next(&u2, enc);
+    }
+    /* nulls can only be left once a lead surrogate made the readers count */
+    while ((u1.n > 0) && (u1.c == 0)) {
+        coll_units_next(&u1, enc);
+    }
+    while ((u2.n > 0) && (u2.c == 0)) {
+        coll_units_next(&u2, enc);
+    }
+    if (u1.n > 0) return 1;
+    if (u2.n > 0) return -1;
+    return (diacritic > 0) - (diacritic < 0);
+}
+
+
+
+/*
+** Key cache
+**
+** Sorting n keys, as REINDEX does, compares each of them about log2(n)
+** times, and every compare reads both keys and looks up the collation
+** element of each code unit again.  Once enabled with unifuzz_keycache(1),
+** the weight collations of a connection memoize, for each key they meet,
+** the code units their reader hands out along with their collation element,
+** and compare those vectors instead.  The compare of two vectors runs the
+** very loop of collate_units(), so results are identical with or without
+** the cache.
+**
+** Keys are hash-consed on their content and encoding: the buffers SQLite
+** passes come and go, so a pointer alone doesn't identify a key.  It still
+** finds the entry most of the time, as the sorter keeps its records in place:
+** a table indexed by the key address remembers the last entry seen there,
+** and a byte compare of the key confirms it before the content is hashed.
+** The cache
+** is bounded in bytes, its tables included, and evicts with the clock
+** algorithm: a hit marks an entry as referenced, and the hand spares a
+** referenced entry once, clearing the mark.  Keys bigger than 1/16th of the
+** budget aren't cached.
+**
+** One cache belongs to each connection: it is the user data of the weight
+** collations and of unifuzz_keycache(), and the last of them to go frees it.
+*/
+#define KEYCACHE_DEFAULT_BYTES  (16 * 1024 * 1024)
+#define KEYCACHE_MIN_BYTES      (64 * 1024)
+#define KEYCACHE_BYTES_PER_KEY  128         /* expected, sets the number of entries */
+#define KEYCACHE_HASH_MUL       0x9E3779B97F4A7C15ULL
+
+typedef struct keyCacheEntry_ {
+    u64 hash;               /* hash of enc and the key bytes */
+    int enc;                /* SQLITE_UTF8 or SQLITE_UTF16LE */
+    int nKey;               /* size of the key in bytes */
+    int nUnit;              /* number of code units handed out by the reader */
+    int nByte;              /* size of the allocation */
+    int next;               /* next entry in the bucket or on the free list, -1 at the end */
+    int referenced;         /* clock mark, set by hits */
+    u32 *aCe;               /* collation element of each code unit, 0 if the entry is unused */
+    u16 *aC;                /* code units */
+    u8 *pKey;               /* copy of the key bytes */
+} KeyCacheEntryT;
+
+typedef struct keyCache_ {
+    int nRef;               /* registrations using this cache */
+    int enabled;
+    sqlite3_int64 nBytesMax;    /* memory budget */
+    sqlite3_int64 nBytes;       /* memory used, tables included */
+    int nEntryMax;          /* size of aEntry */
+    int nEntry;             /* entries in use */
+    int mask;               /* number of buckets - 1 */
+    int hand;               /* clock hand, index in aEntry */
+    int freeList;           /* first unused entry, -1 if none */
+    int *aBucket;           /* first entry of each bucket, -1 if none */
+    int *aAt;               /* last entry seen at each key address, -1 if none */
+    KeyCacheEntryT *aEntry;
+    sqlite3_int64 nHit;
+    sqlite3_int64 nMiss;
+    sqlite3_int64 nEvict;
+} KeyCacheT;
+
+SQLITE_PRIVATE void keycache_clear(KeyCacheT *p){
+    int i;
+    if (p->aEntry) {
+        for (i = 0; i < p->nEntryMax; i++) {
+            sqlite3_free(p->aEntry[i].aCe);
+        }
+    }
+    sqlite3_free(p->aEntry);
+    sqlite3_free(p->aBucket);
+    sqlite3_free(p->aAt);
+    p->aEntry = 0;
+    p->aBucket = 0;
+    p->aAt = 0;
+    p->nEntryMax = 0;
+    p->nEntry = 0;
+    p->nBytes = 0;
+    p->enabled = 0;
+}
+
+SQLITE_PRIVATE int keycache_enable(KeyCacheT *p, sqlite3_int64 nBytesMax){
+    sqlite3_int64 nTable;
+    int i, nBucket = 1;
+    if (p->enabled && (p->nBytesMax == nBytesMax)) {
+        return SQLITE_OK;
+    }
+    keycache_clear(p);
+    if (nBytesMax < KEYCACHE_MIN_BYTES) nBytesMax = KEYCACHE_MIN_BYTES;
+    p->nEntryMax = (int) min(nBytesMax / KEYCACHE_BYTES_PER_KEY, 1 << 24);
+    while (nBucket < p->nEntryMax) {
+        nBucket <<= 1;
+    }
+    nTable = 2 * nBucket * (sqlite3_int64) sizeof(int) + p->nEntryMax * (sqlite3_int64) sizeof(KeyCacheEntryT);
+    p->aBucket = sqlite3_malloc64(nBucket * sizeof(int));
+    p->aAt = sqlite3_malloc64(nBucket * sizeof(int));
+    p->aEntry = sqlite3_malloc64(p->nEntryMax * sizeof(KeyCacheEntryT));
+    if ((p->aBucket == 0) || (p->aAt == 0) || (p->aEntry == 0)) {
+        keycache_clear(p);
+        return SQLITE_NOMEM;
+    }
+    for (i = 0; i < nBucket; i++) {
+        p->aBucket[i] = p->aAt[i] = -1;
+    }
+    for (i = 0; i < p->nEntryMax; i++) {
+        p->aEntry[i].aCe = 0;
+        p->aEntry[i].next = i + 1;
+    }
+    p->aEntry[p->nEntryMax - 1].next = -1;
+    p->mask = nBucket - 1;
+    p->freeList = 0;
+    p->hand = 0;
+    p->nBytes = nTable;
+    p->nBytesMax = (nBytesMax > 2 * nTable) ? nBytesMax : 2 * nTable;
+    p->nHit = p->nMiss = p->nEvict = 0;
+    p->enabled = 1;
+    return SQLITE_OK;
+}
+
+SQLITE_PRIVATE void keycache_release(void *pArg){
+    KeyCacheT *p = (KeyCacheT *) pArg;
+    if (--p->nRef == 0) {
+        keycache_clear(p);
+        sqlite3_free(p);
+    }
+}
+
+/*
+** Unlinks entry i from its bucket and puts it on the free list
+*/
+SQLITE_PRIVATE void keycache_evict(KeyCacheT *p, int i){
+    KeyCacheEntryT *e = &p->aEntry[i];
+    int *pi = &p->aBucket[e->hash & (p->mask)];
+    while (*pi != i) {
+        pi = &p->aEntry[*pi].next;
+    }
+    *pi = e->next;
+    p->nBytes -= e->nByte;
+    sqlite3_free(e->aCe);
+    e->aCe = 0;
+    e->next = p->freeList;
+    p->freeList = i;
+    p->nEntry--;
+    p->nEvict++;
+}
+
+/*
+** Entry of a key, built on a miss, or 0 if the key isn't cached.  Entry
+** iKeep, the other operand of the compare, is never evicted.
+*/
+SQLITE_PRIVATE KeyCacheEntryT *keycache_get(
+    KeyCacheT *p,
+    int enc,
+    int nKey,
+    const void *pKey,
+    int iKeep
+){
+    const u8 *z = (const u8 *) pKey;
+    KeyCacheEntryT *e;
+    CollUnitsT u;
+    u64 h = (u64) enc, w;
+    sqlite3_int64 nByte;
+    int i, n, nMaxUnit;
+    int *pAt = &p->aAt[(((size_t) pKey) >> 3) & p->mask];
+
+    i = *pAt;
+    if (i >= 0) {
+        e = &p->aEntry[i];
+        if (e->aCe && (e->nKey == nKey) && (e->enc == enc) && (memcmp(e->pKey, pKey, nKey) == 0)) {
+            e->referenced = 1;
+            p->nHit++;
+            return e;
+        }
+    }
+    for (i = 0; i + 8 <= nKey; i += 8) {
+        memcpy(&w, &z[i], 8);
+        h = (h ^ w) * KEYCACHE_HASH_MUL;
+        h ^= h >> 32;
+    }
+    for (w = 0; i < nKey; i++) {
+        w = (w << 8) | z[i];
+    }
+    h = (h ^ w ^ ((u64) nKey << 56)) * KEYCACHE_HASH_MUL;
+    h ^= h >> 29;
+    for (i = p->aBucket[h & (p->mask)]; i >= 0; i = e->next) {
+        e = &p->aEntry[i];
+        if ((e->hash == h) && (e->nKey == nKey) && (e->enc == enc) && (memcmp(e->pKey, pKey, nKey) == 0)) {
+            e->referenced = 1;
+            p->nHit++;
+            *pAt = i;
+            return e;
+        }
+    }
+    p->nMiss++;
+
+    /* code units, then their elements, then the key: one allocation */
+    nMaxUnit = (enc == SQLITE_UTF8) ? nKey : nKey / 2;
+    nByte = nMaxUnit * (sqlite3_int64) (sizeof(u32) + sizeof(u16)) + nKey;
+    if ((nKey == 0) || (nByte > p->nBytesMax / 16)) {
+        return 0;
+    }
+    for (n = 0; (p->freeList < 0) || (p->nBytes + nByte > p->nBytesMax); n++) {
+        if (n > 2 * p->nEntryMax) return 0;    /* only iKeep is left */
+        e = &p->aEntry[p->hand];
+        if (e->aCe && (p->hand != iKeep)) {
+            if (e->referenced) {
+                e->referenced = 0;
+            } else {
+                keycache_evict(p, p->hand);
+            }
+        }
+        if (++p->hand == p->nEntryMax) p->hand = 0;
+    }
+
+    i = p->freeList;
+    e = &p->aEntry[i];
+    e->aCe = sqlite3_malloc64(nByte);
+    if (e->aCe == 0) {
+        return 0;
+    }
+    p->freeList = e->next;
+    e->aC = (u16 *) &e->aCe[nMaxUnit];
+    e->pKey = (u8 *) &e->aC[nMaxUnit];
+    memcpy(e->pKey, pKey, nKey);
+    e->nUnit = 0;
+    for (coll_units_start(&u, enc, pKey, nKey, 0); u.n > 0; coll_units_next(&u, enc)) {
+        e->aC[e->nUnit] = u.c;
+        e->aCe[e->nUnit] = COLLATION_ELEMENT(u.c);
+        e->nUnit++;
+    }
+    e->hash = h;
+    e->enc = enc;
+    e->nKey = nKey;
+    e->nByte = (int) nByte;
+    e->referenced = 0;
+    e->next = p->aBucket[h & (p->mask)];
+    p->aBucket[h & (p->mask)] = i;
+    *pAt = i;
+    p->nBytes += nByte;
+    p->nEntry++;
+    return e;
+}
+
+/*
+** collate_units() on two cached keys: the same loop, on the vectors
+*/
+SQLITE_PRIVATE int collate_cached(
+    int flags,
+    const KeyCacheEntryT *e1,
+    const KeyCacheEntryT *e2
+){
+    u32 ce1, ce2;
+    int i1 = 0, i2 = 0, diacritic = 0;
+    while ((i1 < e1->nUnit) && (i2 < e2->nUnit)) {
+        ce1 = e1->aCe[i1];
+        ce2 = e2->aCe[i2];
+        if (flags & COLLATE_IGNORESYMBOLS) {
+            int skip = 0;
+            if (IS_IGNORED_SYMBOL(ce1, e1->aC[i1])) {
+                i1++;
+                skip = 1;
+            }
+            if (IS_IGNORED_SYMBOL(ce2, e2->aC[i2])) {
+                i2++;
+                skip = 1;
+            }
+            if (skip) continue;
+        }
+        if (HAS_COLLATION_ELEMENTS(ce1, ce2)) {
+            if ((ce1 ^ ce2) >> 16) {
+                return ((ce1 >> 16) < (ce2 >> 16)) ? -1 : 1;
+            }
+            if (!(flags & COLLATE_IGNORENONSPACE) && (diacritic == 0)) {
+                diacritic = (int) ((ce1 >> 8) & 0xFF) - (int) ((ce2 >> 8) & 0xFF);
+            }
+        } else if (e1->aC[i1] != e2->aC[i2]) {
+            return (e1->aC[i1] < e2->aC[i2]) ? -1 : 1;
+        }
+        i1++;
+        i2++;
+    }
+    while ((i1 < e1->nUnit) && (e1->aC[i1] == 0)) {
+        i1++;
+    }
+    while ((i2 < e2->nUnit) && (e2->aC[i2] == 0)) {
+        i2++;
+    }
+    if (i1 < e1->nUnit) return 1;
+    if (i2 < e2->nUnit) return -1;
+    return (diacritic > 0) - (diacritic < 0);
+}
+
+/*
+** Compare through the cache, or with collate_units() for keys it can't hold
+*/
+SQLITE_PRIVATE int keycache_collate(
+    KeyCacheT *p,
+    int flags,
+    int enc,
+    int nKey1,
+    const void *pKey1,
+    int nKey2,
+    const void *pKey2
+){
+    KeyCacheEntryT *e1, *e2 = 0;
+    if ((nKey1 == nKey2) && (memcmp(pKey1, pKey2, nKey1) == 0)) {
+        return 0;
+    }
+    e1 = keycache_get(p, enc, nKey1, pKey1, -1);
+    if (e1) e2 = keycache_get(p, enc, nKey2, pKey2, (int) (e1 - p->aEntry));
+    if (e2) return collate_cached(flags, e1, e2);
+    if (enc == SQLITE_UTF8) return collate_units(flags, SQLITE_UTF8, nKey1, pKey1, nKey2, pKey2);
+    return collate_units(flags, SQLITE_UTF16LE, nKey1, pKey1, nKey2, pKey2);
+}
+
+#define KEYCACHE_COLLATE(pArg, flags, enc, nKey1, pKey1, nKey2, pKey2)      \
+    (((pArg) && ((KeyCacheT *) (pArg))->enabled)                            \
+        ? keycache_collate((KeyCacheT *) (pArg), flags, enc, nKey1, pKey1, nKey2, pKey2)   \
+        : collate_units(flags, enc, nKey1, pKey1, nKey2, pKey2))
+
+/*
+** unifuzz_keycache(on [, bytes]) enables the key cache of the connection,
+** with a budget of bytes (16 MiB by default), or disables and empties it.
+** unifuzz_keycache() returns its statistics as text.
+*/
+SQLITE_PRIVATE void keycacheFunc(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
+){
+    KeyCacheT *p = (KeyCacheT *) sqlite3_user_data(context);
+    sqlite3_int64 nLookup;
+    char *z;
+
+    if (argc == 0) {
+        nLookup = p->nHit + p->nMiss;
+        z = sqlite3_mprintf("enabled %d, entries %d, memory %lld / %lld bytes, hits %lld, misses %lld, "
+                            "hit rate %.1f%%, evictions %lld",
+                            p->enabled, p->nEntry, p->nBytes, p->enabled ? p->nBytesMax : 0,
+                            p->nHit, p->nMiss, nLookup ? 100.0 * p->nHit / nLookup : 0.0, p->nEvict);
+        if (z == 0) {
+            sqlite3_result_error_nomem(context);
+            return;
+        }
+        sqlite3_result_text(context, z, -1, sqlite3_free);
+        return;
+    }
+    if (sqlite3_value_int(argv[0])) {
+        sqlite3_int64 nBytesMax = (argc > 1) ? sqlite3_value_int64(argv[1]) : KEYCACHE_DEFAULT_BYTES;
+        if (nBytesMax <= 0) {
+            sqlite3_result_error(context, "unifuzz_keycache: the budget must be positive", -1);
+            return;
+        }
+        if (keycache_enable(p, nBytesMax) != SQLITE_OK) {
+            sqlite3_result_error_nomem(context);
+            return;
+        }
+    } else {
+        keycache_clear(p);
+    }
+    sqlite3_result_int(context, p->enabled);
+}
+
+/*
+** Registers a weight collation with the key cache of the connection as its
+** user data
+*/
+SQLITE_PRIVATE int keycache_create_collation(
+    sqlite3 *db,
+    const char *zName,
+    int enc,
+    KeyCacheT *p,
+    int (*xCompare)(void *, int, const void *, int, const void *)
+){
+    int rc;
+    p->nRef++;
+    rc = sqlite3_create_collation_v2(db, zName, enc, p, xCompare, keycache_release);
+    if (rc != SQLITE_OK) {
+        p->nRef--;
+    }
+    return rc;
+}
+
+
+/*
+** The built-in collating sequence NOCASE is extended to accomodate the
+** Unicode case folding mapping tables to normalize characters to their
+** fold equivalents and test them for equality.
+**
+** The UTF-16LE versions below are the reference, the UTF-8 versions further
+** down give the very same results.
+*/
+SQLITE_PRIVATE int nocase_collate(
+    void *pCache,
+    int nKey1,
+    const void *pKey1,
+    int nKey2,
+    const void *pKey2
+){
+    return KEYCACHE_COLLATE(pCache, NOCASE_FLAGS, SQLITE_UTF16LE, nKey1, pKey1, nKey2, pKey2);
+}
+
+
+/*
+** Similar to the above but ignores diacritics
+*/
+SQLITE_PRIVATE int unaccented_collate(
+    void *pCache,
+    int nKey1,
+    const void *pKey1,
+    int nKey2,
+    const void *pKey2
+){
+    return KEYCACHE_COLLATE(pCache, UNACCENTED_FLAGS, SQLITE_UTF16LE, nKey1, pKey1, nKey2, pKey2);
+}
+
+
+/*
+** Similar to the above but also ignores hyphens and apostrophes, symbols and punctuation
+*/
+SQLITE_PRIVATE int names_collate(
+    void *pCache,
+    int nKey1,
+    const void *pKey1,
+    int nKey2,
+    const void *pKey2
+){
+    return KEYCACHE_COLLATE(pCache, NAMES_FLAGS, SQLITE_UTF16LE, nKey1, pKey1, nKey2, pKey2);
+}
+
+
+/*
+** Numeric prefix of a NUMERICS key: leading whitespace, up to one sign,
+** then digits.  Leading zeros are not significant, so that digit strings of
+** the same value have the same length and compare lexically whatever their
+** length: there is no overflow.  sign is 0 when the value is zero.
+*/
+typedef struct numPrefix_ {
+    const u8 *zDigits;      /* first significant digit */
+    const u8 *zRest;        /* first byte after the numeric prefix */
+    const u8 *zTerm;        /* first byte past the key */
+    int nDigits;            /* number of significant digits */
+    int sign;               /* -1, 0 or +1 */
+} NumPrefixT;
+
+/*
+** Read one codepoint of a UTF-8 or UTF-16LE key, ASCII without decoding.
+** Codepoints beyond U+10FFFF (which only overlong UTF-8 garbage can produce)
+** are wrapped the way a round trip through UTF-16 would, so that both
+** encodings agree.
+*/
+UNIFUZZ_INLINE u32 numeric_read(
+    int enc,
+    const u8 **pz,
+    const u8 *zTerm
+){
+    u32 uc;
+    if (enc == SQLITE_UTF8) {
+        const u8 *z = *pz;
+        if (*z < 0x80) {
+            *pz = z + 1;
+            return *z;
+        }
+        READ_UTF8(z, zTerm, uc);
+        if (uc > 0xFFFF) uc = 0x10000 + ((uc - 0x10000) & 0xFFFFF);
+        *pz = z;
+    } else {
+        const u16 *w = (const u16 *) *pz;
+        if (*w < 0x80) {
+            *pz = (const u8 *) (w + 1);
+            return *w;
+        }
+        READ_UTF16(w, (const u16 *) zTerm, uc);
+        *pz = (const u8 *) w;
+    }
+    return uc;
+}
+
+SQLITE_PRIVATE void numeric_prefix(
+    NumPrefixT *p,
+    int enc,
+    const u8 *z,
+    int n
+){
+    const u8 *q;
+    u32 uc;
+    int cls, sign = 1;
+    p->zTerm = z + ((enc == SQLITE_UTF8) ? n : (n & ~1));
+    p->nDigits = 0;
+    p->zDigits = 0;
+    while (z < p->zTerm) {      /* skip any whitespace */
+        q = z;
+        uc = numeric_read(enc, &z, p->zTerm);
+        cls = NUMCLASS(uc);
+        if (cls != NUMCLASS_SPACE) {
+            z = q;
+            break;
+        }
+    }
+    if (z < p->zTerm) {
+        q = z;
+        uc = numeric_read(enc, &z, p->zTerm);
+        cls = NUMCLASS(uc);
+        if (cls == NUMCLASS_MINUS) {
+            sign = -1;
+        } else if (cls != NUMCLASS_PLUS) {
+            z = q;
+        }
+    }
+    while (z < p->zTerm) {      /* read digits, if any */
+        q = z;
+        uc = numeric_read(enc, &z, p->zTerm);
+        cls = NUMCLASS(uc);
+        if (cls < NUMCLASS_DIGIT) {
+            z = q;
+            break;
+        }
+        if (p->nDigits == 0) {
+            if (cls == NUMCLASS_DIGIT) continue;    /* leading zero */
+            p->zDigits = q;
+        }
+        p->nDigits++;
+    }
+    p->zRest = z;
+    p->sign = (p->nDigits == 0) ? 0 : sign;
+}
+
+/*
+** Compare the numeric prefixes of two keys.  When they have the same value,
+** returns 0 with the keys moved past them for the rest to be compared.
+*/
+SQLITE_PRIVATE int numerics_compare(
+    int enc,
+    const u8 **pz1,
+    int *pn1,
+    const u8 **pz2,
+    int *pn2
+){
+    NumPrefixT a, b;
+    const u8 *z1, *z2;
+    u32 u1, u2;
+    int i, d1, d2;
+    numeric_prefix(&a, enc, *pz1, *pn1);
+    numeric_prefix(&b, enc, *pz2, *pn2);
+    if (a.sign != b.sign) {
+        return (a.sign < b.sign) ? -1 : 1;
+    }
+    if (a.nDigits != b.nDigits) {
+        return (a.nDigits < b.nDigits) ? -a.sign : a.sign;
+    }
+    z1 = a.zDigits;
+    z2 = b.zDigits;
+    for (i = 0; i < a.nDigits; i++) {
+        u1 = numeric_read(enc, &z1, a.zTerm);
+        u2 = numeric_read(enc, &z2, b.zTerm);
+        if (u1 == u2) continue;
+        d1 = NUMCLASS(u1);
+        d2 = NUMCLASS(u2);
+        if (d1 != d2) {
+            return (d1 < d2) ? -a.sign : a.sign;
+        }
+    }
+    *pn1 -= (int) (a.zRest - *pz1);
+    *pz1 = a.zRest;
+    *pn2 -= (int) (b.zRest - *pz2);
+    *pz2 = b.zRest;
+    return 0;
+}
+
+
+/*
+** This collation performs a numeric sort on text data,
+** where items are expected to have a variable-size numeric
+** prefix optionally followed by a non-numeric part.
+** Here "numeric characters" mean all Unicode codepoints for
+** numerics having 0..9 equivalence.  This doesn't include
+** roman numerals nor exotic or ancient digit representations
+** which don't use the decimal positional system.
+** Only decimal (digits, litterally) positional systems
+** are dealt with (see table above).
+** Whitespaces are allowed only before the numeric part (see table above).
+** Numeric part can have up to one plus or minus sign (see table above).
+** Items not starting by "spaces" then "sign" then "digits" have value 0.
+** Numbers of any length are compared exactly (see numerics_compare()).
+**
+** The optional rest of the strings are sorted by the NOCASE collation
+** defined above.  For this we need the strings to be UTF-16LE encoded.
+*/
+
+SQLITE_PRIVATE int numerics_collate(
+    void *encoding,
+    int nKey1,
+    const void *pKey1,
+    int nKey2,
+    const void *pKey2
+){
+    const u8 *p1 = (const u8 *) pKey1, *p2 = (const u8 *) pKey2;
+    int rc;
+    if ((nKey1 == nKey2) && (pKey1 != 0) && (pKey2 != 0) && (memcmp(pKey1, pKey2, nKey1) == 0)) {
+        return 0;
+    }
+    if (p1 == 0) nKey1 = 0;
+    if (p2 == 0) nKey2 = 0;
+    rc = numerics_compare(SQLITE_UTF16LE, &p1, &nKey1, &p2, &nKey2);
+    if (rc) return rc;
+    return nocase_collate(encoding, nKey1, p1, nKey2, p2);
+}
+
+
+#ifdef UNIFUZZ_UTF8_COLLATION
+
+/*
+**==========================================================================================================
+**
+**          UTF-8 versions of the collations
+**
+**          They give the very same results as the UTF-16LE versions above, without SQLite having
+**          to convert both keys to UTF-16 before every single compare.
+**
+**==========================================================================================================
+*/
+
+/*
+** UTF-8 version of nocase_collate
+*/
+SQLITE_PRIVATE int nocase_collate8(
+    void *pCache,
+    int nKey1,
+    const void *pKey1,
+    int nKey2,
+    const void *pKey2
+){
+    return KEYCACHE_COLLATE(pCache, NOCASE_FLAGS, SQLITE_UTF8, nKey1, pKey1, nKey2, pKey2);
+}
+
+
+/*
+** UTF-8 version of unaccented_collate
+*/
+SQLITE_PRIVATE int unaccented_collate8(
+    void *pCache,
+    int nKey1,
+    const void *pKey1,
+    int nKey2,
+    const void *pKey2
+){
+    return KEYCACHE_COLLATE(pCache, UNACCENTED_FLAGS, SQLITE_UTF8, nKey1, pKey1, nKey2, pKey2);
+}
+
+
+/*
+** UTF-8 version of names_collate
+*/
+SQLITE_PRIVATE int names_collate8(
+    void *pCache,
+    int nKey1,
+    const void *pKey1,
+    int nKey2,
+    const void *pKey2
+){
+    return KEYCACHE_COLLATE(pCache, NAMES_FLAGS, SQLITE_UTF8, nKey1, pKey1, nKey2, pKey2);
+}
+
+
+/*
+** UTF-8 version of numerics_collate
+*/
+SQLITE_PRIVATE int numerics_collate8(
+    void *encoding,
+    int nKey1,
+    const void *pKey1,
+    int nKey2,
+    const void *pKey2
+){
+    const u8 *p1 = (const u8 *) pKey1, *p2 = (const u8 *) pKey2;
+    int rc;
+    if ((nKey1 == nKey2) && (pKey1 != 0) && (pKey2 != 0) && (memcmp(pKey1, pKey2, nKey1) == 0)) {
+        return 0;
+    }
+    if (p1 == 0) nKey1 = 0;
+    if (p2 == 0) nKey2 = 0;
+    rc = numerics_compare(SQLITE_UTF8, &p1, &nKey1, &p2, &nKey2);
+    if (rc) return rc;
+    return nocase_collate8(encoding, nKey1, p1, nKey2, p2);
+}
+
+#endif  // UNIFUZZ_UTF8_COLLATION
+
+
+/*
+** Sort keys
+**
+** A key lays out the levels that the collation compares, in the order it
+** compares them, so that comparing keys with memcmp() follows the collation:
+**
+**   unicode weights  - 2 bytes per code unit, the weight plus one, or 0xFFFF
+**                      followed by the code unit itself when it has no
+**                      collation element; then 0x00 0x00
+**   ignored symbols  - with COLLATE_IGNORESYMBOLS, one 0x01 byte per symbol
+**                      after the last code unit that isn't one; then 0x00
+**   diacritic weight - 1 byte per code unit, unless COLLATE_IGNORENONSPACE
+**
+** Ignored symbols are left out of every level and trailing nulls are
+** ignored.  The collations compare the first Utf16CharLen() code units of a
+** key, so do the keys.
+**
+** Returns the length of the key of the n code units at z, and writes it to
+** zKey unless zKey is 0.
+*/
+SQLITE_PRIVATE int collate_sortkey(
+    int flags,
+    const u16 *z,
+    int n,
+    u8 *zKey
+){
+    u8 *zDiacritic;
+    u32 ce;
+    int i, chars = 0, trailing = 0, len = 0;
+
+    while ((n > 0) && (z[n - 1] == 0)) {
+        n--;
+    }
+    for (i = 0; i < n; i++) {
+        ce = COLLATION_ELEMENT(z[i]);
+        if ((flags & COLLATE_IGNORESYMBOLS) && IS_IGNORED_SYMBOL(ce, z[i])) {
+            trailing++;
+            continue;
+        }
+        trailing = 0;
+        chars++;
+        len += HAS_COLLATION_ELEMENTS(ce, 0) ? 2 : 4;
+    }
+    len += 2;
+    if (flags & COLLATE_IGNORESYMBOLS) len += trailing + 1;
+    if (!(flags & COLLATE_IGNORENONSPACE)) len += chars;
+    if (zKey == 0) return len;
+
+    zDiacritic = &zKey[len - chars];
+    for (i = 0; i < n; i++) {
+        ce = COLLATION_ELEMENT(z[i]);
+        if ((flags & COLLATE_IGNORESYMBOLS) && IS_IGNORED_SYMBOL(ce, z[i])) continue;
+        if (HAS_COLLATION_ELEMENTS(ce, 0)) {
+            *zKey++ = (u8) (((ce >> 16) + 1) >> 8);
+            *zKey++ = (u8) ((ce >> 16) + 1);
+            if (!(flags & COLLATE_IGNORENONSPACE)) *zDiacritic++ = (u8) (ce >> 8);
+        } else {
+            *zKey++ = 0xFF;
+            *zKey++ = 0xFF;
+            *zKey++ = (u8) (z[i] >> 8);
+            *zKey++ = (u8) z[i];
+            if (!(flags & COLLATE_IGNORENONSPACE)) *zDiacritic++ = 0;
+        }
+    }
+    *zKey++ = 0;
+    *zKey++ = 0;
+    if (flags & COLLATE_IGNORESYMBOLS) {
+        for (i = 0; i < trailing; i++) *zKey++ = 1;
+        *zKey++ = 0;
+    }
+    return len;
+}
+
+static const int nocase_key_flags = NOCASE_FLAGS;
+static const int unaccented_key_flags = UNACCENTED_FLAGS;
+static const int names_key_flags = NAMES_FLAGS;
+
+SQLITE_PRIVATE void sortkeyFunc16(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
+){
+    const u16 *z;
+    u8 *zKey;
+    int flags, n, len;
+
+    assert(argc == 1);
+    z = (const u16 *) sqlite3_value_text16(argv[0]);
+    if (z == 0) {
+        return;
+    }
+    flags = *(const int *) sqlite3_user_data(context);
+    n = Utf16CharLen(z, sqlite3_value_bytes16(argv[0]));
+    len = collate_sortkey(flags, z, n, 0);
+    zKey = contextMalloc(context, len);
+    if (zKey) {
+        collate_sortkey(flags, z, n, zKey);
+        sqlite3_result_blob(context, zKey, len, sqlite3_free);
+    }
+}
+
+
+/*
+** Abbreviated keys
+**
+** rmnocase_abbrev(str) encodes the unicode weights of str, one code unit
+** after the other, with the codes of coll_abbrev[] (see tools/mkweights.c):
+** one byte for the weights of Latin letters, two bytes for the others, and
+** 0xFF followed by the code unit itself for code units without collation
+** element.  The first 8 bytes, zero padded, make a big-endian integer whose
+** sign bit is flipped.  The codes order the weights as the first level of
+** rmnocase_key() does, and none is the prefix of another one, so the
+** integers never contradict RMNOCASE; ties need a full compare.
+**
+** Only the first code units can reach those 8 bytes, so they are read from
+** the text as it is stored, without converting it to UTF-16.
+*/
+#define ABBREV_BYTES    8
+
+SQLITE_PRIVATE sqlite3_int64 collate_abbrev(
+    int enc,
+    const void *pKey,
+    int nKey
+){
+    CollUnitsT k;
+    u8 zAbbrev[ABBREV_BYTES + 2];
+    sqlite3_uint64 x = 0;
+    u16 code;
+    int i, len = 0;
+
+    memset(zAbbrev, 0, sizeof(zAbbrev));
+    coll_units_start(&k, enc, pKey, nKey, 0);
+    while ((len < ABBREV_BYTES) && (k.n > 0)) {
+        code = coll_abbrev[k.c];
+        if (code == 0) {
+            zAbbrev[len++] = 0xFF;
+            zAbbrev[len++] = (u8) (k.c >> 8);
+            zAbbrev[len++] = (u8) k.c;
+        } else if (code < 0x100) {
+            zAbbrev[len++] = (u8) code;
+        } else {
+            zAbbrev[len++] = (u8) (code >> 8);
+            zAbbrev[len++] = (u8) code;
+        }
+        coll_units_next(&k, enc);
+    }
+    for (i = 0; i < ABBREV_BYTES; i++) {
+        x = (x << 8) | zAbbrev[i];
+    }
+    return (sqlite3_int64) (x ^ ((sqlite3_uint64) 1 << 63));
+}
+
+SQLITE_PRIVATE void abbrevFunc16(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
+){
+    const u16 *z;
+
+    assert(argc == 1);
+    z = (const u16 *) sqlite3_value_text16(argv[0]);
+    if (z == 0) {
+        return;
+    }
+    sqlite3_result_int64(context, collate_abbrev(SQLITE_UTF16LE, z, sqlite3_value_bytes16(argv[0])));
+}
+
+#ifdef UNIFUZZ_UTF8_COLLATION
+SQLITE_PRIVATE void abbrevFunc8(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
+){
+    const u8 *z;
+
+    assert(argc == 1);
+    z = sqlite3_value_text(argv[0]);
+    if (z == 0) {
+        return;
+    }
+    sqlite3_result_int64(context, collate_abbrev(SQLITE_UTF8, z, sqlite3_value_bytes(argv[0])));
+}
+#endif
+
+
+/*
+** Canonical forms
+**
+** Two strings compare equal with a collation exactly when they give the same
+** code units once each one is replaced by its canonical code unit, the lowest
+** one with the same weights (see coll_canon[] in unifuzz_weights.h).  NAMES
+** leaves out the symbols it ignores, but the symbols after the last code
+** unit that isn't one still count: they become as many spaces at the end.
+** Code units without collation element stand for themselves.  Where the
+** collations stop in the middle of a surrogate pair (see Utf16CharLen()),
+** the canonical form ends with the lone lead surrogate they compared.
+**
+** The hash is the 64-bit FNV-1a of the canonical code units, finished with
+** a mix of its bits so that any subset of them makes a fair bucket number.
+**
+** Writes the canonical form of the key to zCanon and its hash to pHash,
+** unless they are 0, and returns the number of canonical code units.
+*/
+#define CANON_HASH_BASIS    0xCBF29CE484222325ULL
+#define CANON_HASH_PRIME    0x00000100000001B3ULL
+
+SQLITE_PRIVATE int collate_canon(
+    int flags,
+    int enc,
+    const void *pKey,
+    int nKey,
+    u16 *zCanon,
+    sqlite3_uint64 *pHash
+){
+    const u16 *canon = coll_canon[(flags & COLLATE_IGNORENONSPACE) ? 1 : 0];
+    CollUnitsT k;
+    sqlite3_uint64 h = CANON_HASH_BASIS;
+    u16 c;
+    int n = 0, trailing = 0;
+
+    for (coll_units_start(&k, enc, pKey, nKey, 0); k.n > 0; coll_units_next(&k, enc)) {
+        if ((flags & COLLATE_IGNORESYMBOLS) && IS_IGNORED_SYMBOL(COLLATION_ELEMENT(k.c), k.c)) {
+            trailing++;
+            continue;
+        }
+        trailing = 0;
+        c = canon[k.c];
+        if (zCanon) zCanon[n] = c;
+        h = (h ^ c) * CANON_HASH_PRIME;
+        n++;
+    }
+    for (; trailing > 0; trailing--) {
+        if (zCanon) zCanon[n] = ' ';
+        h = (h ^ ' ') * CANON_HASH_PRIME;
+        n++;
+    }
+    if (pHash) {
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 33;
+        *pHash = h;
+    }
+    return n;
+}
+
+static const int nocase_canon_flags = NOCASE_FLAGS;
+static const int unaccented_canon_flags = UNACCENTED_FLAGS;
+static const int names_canon_flags = NAMES_FLAGS;
+
+/*
+** The canonical form has at most one code unit per UTF-16 code unit of the
+** key, which has at least one byte per UTF-16 code unit as UTF-8.
+*/
+SQLITE_PRIVATE void canonFunc(
+    sqlite3_context *context,
+    int enc,
+    const void *z,
+    int nKey
+){
+    u16 *zCanon;
+    int n;
+
+    zCanon = contextMalloc(context, ((enc == SQLITE_UTF8) ? nKey : nKey / 2) * sizeof(u16) + sizeof(u16));
+    if (zCanon) {
+        n = collate_canon(*(const int *) sqlite3_user_data(context), enc, z, nKey, zCanon, 0);
+        sqlite3_result_text16(context, zCanon, n * sizeof(u16), sqlite3_free);
+    }
+}
+
+SQLITE_PRIVATE void canonFunc16(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
+){
+    const u16 *z;
+
+    assert(argc == 1);
+    z = (const u16 *) sqlite3_value_text16(argv[0]);
+    if (z == 0) {
+        return;
+    }
+    canonFunc(context, SQLITE_UTF16LE, z, sqlite3_value_bytes16(argv[0]));
+}
+
+SQLITE_PRIVATE void hashFunc16(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
+){
+    const u16 *z;
+    sqlite3_uint64 h;
+
+    assert(argc == 1);
+    z = (const u16 *) sqlite3_value_text16(argv[0]);
+    if (z == 0) {
+        return;
+    }
+    collate_canon(*(const int *) sqlite3_user_data(context), SQLITE_UTF16LE, z, sqlite3_value_bytes16(argv[0]), 0, &h);
+    sqlite3_result_int64(context, (sqlite3_int64) h);
+}
+
+#ifdef UNIFUZZ_UTF8_COLLATION
+SQLITE_PRIVATE void canonFunc8(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
+){
+    const u8 *z;
+
+    assert(argc == 1);
+    z = sqlite3_value_text(argv[0]);
+    if (z == 0) {
+        return;
+    }
+    canonFunc(context, SQLITE_UTF8, z, sqlite3_value_bytes(argv[0]));
+}
+
+SQLITE_PRIVATE void hashFunc8(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
+){
+    const u8 *z;
+    sqlite3_uint64 h;
+
+    assert(argc == 1);
+    z = sqlite3_value_text(argv[0]);
+    if (z == 0) {
+        return;
+    }
+    collate_canon(*(const int *) sqlite3_user_data(context), SQLITE_UTF8, z, sqlite3_value_bytes(argv[0]), 0, &h);
+    sqlite3_result_int64(context, (sqlite3_int64) h);
+}
+#endif
+
+/*
+** NATURAL collation: "Box 2" < "Box 10".
+**
+** Keys are compared in a single pass as alternating runs of digits and
+** non-digits.  Where both keys are at a run of digits (all Unicode decimal
+** digits, see numeric_table above), the runs are compared by value: leading
+** zeros are skipped, then the longer run is the greater, else the first
+** different digit decides.  Everything else is compared character by
+** character with the unicode weights of RMNOCASE, the first diacritic
+** difference deciding only when the keys are otherwise equal.  Like
+** NUMERICS, runs of digits of the same value compare equal ("007" = "7").
+**
+** Supplementary characters are compared as CompareStringW would compare
+** their surrogate pairs.  Like the other collations, keys end at their
+** first null.
+*/
+
+/*
+** Return the class of the next character if it is a digit and move past it,
+** else -1 without moving
+*/
+UNIFUZZ_INLINE int natural_next_digit(
+    int enc,
+    const u8 **pz,
+    const u8 *zTerm
+){
+    const u8 *z = *pz;
+    u32 c;
+    int cls;
+    if (z >= zTerm) return -1;
+    c = numeric_read(enc, &z, zTerm);
+    cls = NUMCLASS(c);
+    if (cls < NUMCLASS_DIGIT) return -1;
+    *pz = z;
+    return cls;
+}
+
+/*
+** First byte past the key z of n bytes, or its first null
+*/
+UNIFUZZ_INLINE const u8 *natural_key_end(
+    int enc,
+    const u8 *z,
+    int n
+){
+    const u8 *zNull;
+    const u16 *w, *wTerm;
+    if (n <= 0) return z;
+    if (enc == SQLITE_UTF8) {
+        zNull = (const u8 *) memchr(z, 0, n);
+        return zNull ? zNull : z + n;
+    }
+    w = (const u16 *) z;
+    wTerm = w + n / (int) sizeof(u16);
+    while ((w < wTerm) && (*w != 0)) w++;
+    return (const u8 *) w;
+}
+
+#define ASCII_DIGIT(c)      ((u32) ((c) - '0') < 10)
+
+UNIFUZZ_INLINE int natural_units(
+    int enc,
+    int nKey1,
+    const void *pKey1,
+    int nKey2,
+    const void *pKey2
+){
+    const u8 *z1 = (const u8 *) pKey1, *z2 = (const u8 *) pKey2, *zTerm1, *zTerm2;
+    u32 c1, c2, w1, w2, ce1, ce2;
+    int d1, d2, bias, diacritic = 0;
+    if ((nKey1 == nKey2) && (memcmp(pKey1, pKey2, nKey1) == 0)) {
+        return 0;
+    }
+    zTerm1 = natural_key_end(enc, z1, nKey1);
+    zTerm2 = natural_key_end(enc, z2, nKey2);
+    while ((z1 < zTerm1) && (z2 < zTerm2)) {
+        c1 = numeric_read(enc, &z1, zTerm1);
+        c2 = numeric_read(enc, &z2, zTerm2);
+        if (((c1 | c2) < 0x80) && !(ASCII_DIGIT(c1) && ASCII_DIGIT(c2))) {
+            /* ASCII characters of equal unicode weight have equal diacritic weight */
+            if (ascii_weights[c1] != ascii_weights[c2]) {
+                return (ascii_weights[c1] < ascii_weights[c2]) ? -1 : 1;
+            }
+            continue;
+        }
+        d1 = NUMCLASS(c1);
+        d2 = NUMCLASS(c2);
+        if ((d1 >= NUMCLASS_DIGIT) && (d2 >= NUMCLASS_DIGIT)) {
+            while (d1 == NUMCLASS_DIGIT) {
+                d1 = natural_next_digit(enc, &z1, zTerm1);
+            }
+            while (d2 == NUMCLASS_DIGIT) {
+                d2 = natural_next_digit(enc, &z2, zTerm2);
+            }
+            bias = 0;
+            while ((d1 >= 0) && (d2 >= 0)) {
+                if ((bias == 0) && (d1 != d2)) {
+                    bias = (d1 < d2) ? -1 : 1;
+                }
+                d1 = natural_next_digit(enc, &z1, zTerm1);
+                d2 = natural_next_digit(enc, &z2, zTerm2);
+            }
+            if (d1 >= 0) return 1;
+            if (d2 >= 0) return -1;
+            if (bias) return bias;
+            continue;
+        }
+        if (c1 == c2) continue;
+        /* a supplementary character looks up and compares its lead surrogate first */
+        w1 = (c1 > 0xFFFF) ? 0xD7C0 + (c1 >> 10) : c1;
+        w2 = (c2 > 0xFFFF) ? 0xD7C0 + (c2 >> 10) : c2;
+        ce1 = COLLATION_ELEMENT(w1);
+        ce2 = COLLATION_ELEMENT(w2);
+        if (HAS_COLLATION_ELEMENTS(ce1, ce2)) {
+            if ((ce1 ^ ce2) >> 16) {
+                return ((ce1 >> 16) < (ce2 >> 16)) ? -1 : 1;
+            }
+            if (diacritic == 0) {
+                diacritic = (int) ((ce1 >> 8) & 0xFF) - (int) ((ce2 >> 8) & 0xFF);
+            }
+        } else if (w1 != w2) {
+            return (w1 < w2) ? -1 : 1;
+        } else {
+            return (c1 < c2) ? -1 : 1;
+        }
+    }
+    if (z1 < zTerm1) return 1;
+    if (z2 < zTerm2) return -1;
+    return (diacritic > 0) - (diacritic < 0);
+}
+
+SQLITE_PRIVATE int natural_collate(
+    void *encoding,
+    int nKey1,
+    const void *pKey1,
+    int nKey2,
+    const void *pKey2
+){
+    UNUSED_PARAMETER(encoding);
+    return natural_units(SQLITE_UTF16LE, nKey1, pKey1, nKey2, pKey2);
+}
+
+#ifdef UNIFUZZ_UTF8_COLLATION
+/*
+** UTF-8 version of natural_collate
+*/
+SQLITE_PRIVATE int natural_collate8(
+    void *encoding,
+    int nKey1,
+    const void *pKey1,
+    int nKey2,
+    const void *pKey2
+){
+    UNUSED_PARAMETER(encoding);
+    return natural_units(SQLITE_UTF8, nKey1, pKey1, nKey2, pKey2);
+}
+#endif  // UNIFUZZ_UTF8_COLLATION
+
+
+
+/*
+** LIKE prefix ranges
+**
+** The unifuzz LIKE compares unaccent(fold()) of its pattern and string, so
+** the built-in LIKE optimization never applies and "Surname LIKE 'smi%'"
+** reads the whole table.  The functions below turn the literal prefix of a
+** pattern (before its first wildcard) into RMNOCASE ranges holding every
+** text it can match, for an RMNOCASE index to seek before LIKE checks the
+** rows:
+**
+**     SELECT n.* FROM like_ranges('smi%') AS r
+**       JOIN NameTable AS n ON n.Surname >= r.lo AND n.Surname < r.hi
+**       WHERE n.Surname LIKE 'smi%';
+**
+** or, as a single range, like_lower_bound(p) and like_upper_bound(p).
+**
+** The normalized prefix is walked one character x at a time.  The
+** characters that can stand at that place in a matching string are those
+** whose normalization agrees with the rest of the prefix: '' and '' for
+** "o", but also '' for "ss" and '' for "ae".  They have several primary
+** weights ('' is not 'o' for RMNOCASE), each giving a range of its own.
+** The walk goes on in the ranges of the weights whose characters all
+** normalize to x alone; the others end at that place.  Up to
+** LIKE_BOUND_RANGES ranges are made, beyond which the places left are
+** covered by one range each.
+**
+** Characters without weight compare to the others by code point, so that
+** no range, nor an index, can place them: those that normalize to a letter
+** ('\u023F' for "s") are left out, as they are by RMNOCASE_KEY.  When x itself
+** has no weight, the range ends before it.
+**
+** A lower bound spells its weights with, for each of them, the character
+** of smallest diacritic weight that can stand there.  An upper bound has
+** the weight that follows the last one, or is a zero length blob, greater
+** than any text, when there is none.  Non text values are never in range.
+*/
+#define LIKE_BOUND_MAX          32      /* characters of the prefix */
+#define LIKE_BOUND_WEIGHTS      8       /* weights per place kept apart */
+#define LIKE_BOUND_RANGES       16
+
+typedef struct likePlace_ {
+    u32 x;                              /* normalized character */
+    int nWeight;                        /* LIKE_BOUND_WEIGHTS + 1 when more */
+    u16 aWeight[LIKE_BOUND_WEIGHTS];    /* sorted */
+    u16 aRep[LIKE_BOUND_WEIGHTS];       /* its character of least diacritic */
+    u8 aRepDiac[LIKE_BOUND_WEIGHTS];
+    u8 aEnd[LIKE_BOUND_WEIGHTS];        /* one of its characters isn't x alone */
+    u16 minWeight, minRep, maxWeight;
+    u8 minRepDiac;
+    u8 noWeight;                        /* x has no weight */
+} LikePlaceT;
+
+typedef struct likeRange_ {
+    u16 aLo[LIKE_BOUND_MAX + 1];
+    int nLo;
+    int nHi;                            /* hi: aLo[0 .. nHi), then cHi */
+    u32 wHi;                            /* cHi is the first weight after wHi */
+    u32 wNext;                          /* weight of cHi, 0x10000 for none */
+    u8 dNext;                           /* diacritic weight of cHi */
+    u16 cHi;
+} LikeRangeT;
+
+typedef struct likeRanges_ {
+    LikePlaceT aPlace[LIKE_BOUND_MAX];
+    int nPlace;
+    u16 aPrefix[LIKE_BOUND_MAX];        /* characters of the walk */
+    u16 aPrefixWeight[LIKE_BOUND_MAX];
+    LikeRangeT aRange[LIKE_BOUND_RANGES];
+    int nRange;
+} LikeRangesT;
+
+/*
+** Normalizes the UTF-16 pattern z of n units as LIKE does and keeps the
+** characters of its literal prefix, escape being the escape character or 0
+*/
+SQLITE_PRIVATE void like_ranges_prefix(
+    LikeRangesT *p,
+    const u16 *z,
+    int n,
+    u32 escape
+){
+    u32 aPat[2 * LIKE_BOUND_MAX], c;
+    const u16 *uac;
+    int i, k, l, nPat = 0, escaped = 0;
+
+    // twice as many as kept: escapes and wildcards are seen after normalization
+    for (i = 0; (i < n) && (nPat < 2 * LIKE_BOUND_MAX); i++) {
+        c = z[i];
+        if ((c >= 0xD800) && (c <= 0xDBFF) && (i + 1 < n) && (z[i + 1] >= 0xDC00) && (z[i + 1] <= 0xDFFF)) {
+            c = 0x10000 + ((c - 0xD800) << 10) + (z[++i] - 0xDC00);
+        }
+        c = unifuzz_fold_unacc(c, &uac, &l);
+        if (l > 0) {
+            for (k = 0; (k < l) && (nPat < 2 * LIKE_BOUND_MAX); k++) aPat[nPat++] = UNACC_CODE(uac[k]);
+        } else {
+            aPat[nPat++] = c;
+        }
+    }
+    p->nPlace = 0;
+    for (i = 0; (i < nPat) && (p->nPlace < LIKE_BOUND_MAX); i++) {
+        c = aPat[i];
+        if (!escaped && escape && (c == escape)) {
+            escaped = 1;
+            continue;
+        }
+        if (!escaped && ((c == '%') || (c == '_'))) break;
+        escaped = 0;
+        p->aPlace[p->nPlace++].x = c;
+    }
+}
+
+/*
+** Adds the weight w of c, of diacritic weight d, to the place p
+*/
+SQLITE_PRIVATE void like_place_add(
+    LikePlaceT *p,
+    u16 w,
+    u16 c,
+    u8 d,
+    int end
+){
+    int i, k;
+
+    if ((p->nWeight == 0) || (w < p->minWeight) || ((w == p->minWeight) && (d < p->minRepDiac))) {
+        p->minWeight = w;
+        p->minRep = c;
+        p->minRepDiac = d;
+    }
+    if ((p->nWeight == 0) || (w > p->maxWeight)) p->maxWeight = w;
+    if (p->nWeight > LIKE_BOUND_WEIGHTS) return;
+    for (i = 0; (i < p->nWeight) && (p->aWeight[i] < w); i++);
+    if ((i < p->nWeight) && (p->aWeight[i] == w)) {
+        if (d < p->aRepDiac[i]) {
+            p->aRep[i] = c;
+            p->aRepDiac[i] = d;
+        }
+        p->aEnd[i] |= end;
+        return;
+    }
+    if (p->nWeight == LIKE_BOUND_WEIGHTS) {
+        p->nWeight++;
+        return;
+    }
+    for (k = p->nWeight; k > i; k--) {
+        p->aWeight[k] = p->aWeight[k - 1];
+        p->aRep[k] = p->aRep[k - 1];
+        p->aRepDiac[k] = p->aRepDiac[k - 1];
+        p->aEnd[k] = p->aEnd[k - 1];
+    }
+    p->aWeight[i] = w;
+    p->aRep[i] = c;
+    p->aRepDiac[i] = d;
+    p->aEnd[i] = (u8) end;
+    p->nWeight++;
+}
+
+/*
+** Adds the range of the strings whose weights start with those of the walk
+** up to place j, then the weights from wLo (character cLo) to wHi at place
+** j when cLo is not 0
+*/
+SQLITE_PRIVATE void like_ranges_add(
+    LikeRangesT *p,
+    int j,
+    u16 cLo,
+    u32 wHi
+){
+    LikeRangeT *pRange = &p->aRange[p->nRange++];
+
+    memcpy(pRange->aLo, p->aPrefix, j * sizeof(u16));
+    pRange->nLo = j;
+    if (cLo) {
+        pRange->aLo[pRange->nLo++] = cLo;
+        pRange->nHi = j;
+        pRange->wHi = wHi;
+    } else if (j > 0) {
+        pRange->nHi = j - 1;
+        pRange->wHi = p->aPrefixWeight[j - 1];
+    } else {
+        pRange->nHi = 0;
+        pRange->wHi = 0x10000;
+    }
+}
+
+/*
+** Makes the ranges of the strings whose weights start with those of the
+** walk up to place j, until p->nRange reaches nLimit at most
+*/
+SQLITE_PRIVATE void like_ranges_walk(
+    LikeRangesT *p,
+    int j,
+    int nLimit
+){
+    LikePlaceT *pPlace = &p->aPlace[j];
+    int i;
+
+    if ((j == p->nPlace) || pPlace->noWeight || (pPlace->nWeight == 0)) {
+        like_ranges_add(p, j, 0, 0);
+        return;
+    }
+    if ((pPlace->nWeight > LIKE_BOUND_WEIGHTS) || (pPlace->nWeight > nLimit - p->nRange)) {
+        like_ranges_add(p, j, pPlace->minRep, pPlace->maxWeight);
+        return;
+    }
+    for (i = 0; i < pPlace->nWeight; i++) {
+        if (pPlace->aEnd[i] || (j + 1 == p->nPlace)) {
+            like_ranges_add(p, j, pPlace->aRep[i], pPlace->aWeight[i]);
+        } else {
+            // one range at least is kept for each of the weights left
+            p->aPrefix[j] = pPlace->aRep[i];
+            p->aPrefixWeight[j] = pPlace->aWeight[i];
+            like_ranges_walk(p, j + 1, nLimit - (pPlace->nWeight - i - 1));
+        }
+    }
+}
+
+SQLITE_PRIVATE void like_ranges(
+    LikeRangesT *p,
+    const u16 *z,
+    int n,
+    u32 escape
+){
+    LikePlaceT *pPlace;
+    LikeRangeT *pRange;
+    u32 c, ce, w, d, first;
+    const u16 *uac;
+    int i, j, k, l;
+
+    memset(p, 0, sizeof(*p));
+    like_ranges_prefix(p, z, n, escape);
+
+    // the characters that can stand at each place of the prefix, and their weights
+    for (c = 0; c < 0x10000; c++) {
+        if ((c >= 0xD800) && (c <= 0xDFFF)) continue;
+        first = unifuzz_fold_unacc(c, &uac, &l);
+        if (l > 0) first = UNACC_CODE(uac[0]);
+        for (j = 0; j < p->nPlace; j++) {
+            pPlace = &p->aPlace[j];
+            if (pPlace->x != first) continue;
+            for (k = 1; (k < l) && (j + k < p->nPlace) && (UNACC_CODE(uac[k]) == p->aPlace[j + k].x); k++);
+            if ((k < l) && (j + k < p->nPlace)) continue;
+            ce = COLLATION_ELEMENT(c);
+            if (!HAS_COLLATION_ELEMENTS(ce, 0)) {
+                if (c == pPlace->x) pPlace->noWeight = 1;
+                continue;
+            }
+            like_place_add(pPlace, (u16) (ce >> 16), (u16) c, (u8) (ce >> 8), (l > 1));
+        }
+    }
+    like_ranges_walk(p, 0, LIKE_BOUND_RANGES);
+
+    // the character of least diacritic weight of the first weight after each range
+    for (i = 0; i < p->nRange; i++) {
+        p->aRange[i].wNext = 0x10000;
+    }
+    for (c = 1; c < 0x10000; c++) {
+        if ((c >= 0xD800) && (c <= 0xDFFF)) continue;
+        ce = COLLATION_ELEMENT(c);
+        if (!HAS_COLLATION_ELEMENTS(ce, 0)) continue;
+        w = ce >> 16;
+        d = (ce >> 8) & 0xFF;
+        for (i = 0; i < p->nRange; i++) {
+            pRange = &p->aRange[i];
+            if ((w > pRange->wHi) && ((w < pRange->wNext) || ((w == pRange->wNext) && (d < pRange->dNext)))) {
+                pRange->wNext = w;
+                pRange->dNext = (u8) d;
+                pRange->cHi = (u16) c;
+            }
+        }
+    }
+}
+
+/*
+** Returns the lower or upper bound of pRange
+*/
+SQLITE_PRIVATE void like_range_result(
+    sqlite3_context *context,
+    LikeRangeT *pRange,
+    int upper
+){
+    u16 aHi[LIKE_BOUND_MAX + 1];
+
+    if (!upper) {
+        sqlite3_result_text16(context, pRange->aLo, pRange->nLo * 2, SQLITE_TRANSIENT);
+    } else if (pRange->wNext == 0x10000) {
+        sqlite3_result_zeroblob(context, 0);
+    } else {
+        memcpy(aHi, pRange->aLo, pRange->nHi * sizeof(u16));
+        aHi[pRange->nHi] = pRange->cHi;
+        sqlite3_result_text16(context, aHi, (pRange->nHi + 1) * 2, SQLITE_TRANSIENT);
+    }
+}
+
+/*
+** Reads the optional escape character of LIKE from pEsc into *pEscape
+*/
+SQLITE_PRIVATE int like_ranges_escape(
+    sqlite3_value *pEsc,
+    u32 *pEscape,
+    char **pzErr
+){
+    const u16 *zEsc = (const u16 *) sqlite3_value_text16(pEsc);
+
+    *pEscape = 0;
+    if (zEsc == 0) return SQLITE_OK;
+    if ((sqlite3_value_bytes16(pEsc) != 2) || ((zEsc[0] >= 0xD800) && (zEsc[0] <= 0xDFFF))) {
+        *pzErr = sqlite3_mprintf("ESCAPE expression must be a single character");
+        return SQLITE_ERROR;
+    }
+    *pEscape = zEsc[0];
+    return SQLITE_OK;
+}
+
+static const int like_bound_lower = 0;
+static const int like_bound_upper = 1;
+
+/*
+** like_lower_bound(pattern [, esc]) and like_upper_bound(pattern [, esc])
+** return the bounds of a single range covering those of like_ranges()
+*/
+SQLITE_PRIVATE void likeBoundFunc(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
+){
+    LikeRangesT *p;
+    const u16 *z;
+    u32 escape = 0;
+    char *zErr = 0;
+    int upper = (*(const int *) sqlite3_user_data(context) == like_bound_upper);
+
+    if (SQLITE_NULL == sqlite3_value_type(argv[0])) return;
+    if ((argc == 2) && (like_ranges_escape(argv[1], &escape, &zErr) != SQLITE_OK)) {
+        sqlite3_result_error(context, zErr, -1);
+        sqlite3_free(zErr);
+        return;
+    }
+    z = (const u16 *) sqlite3_value_text16(argv[0]);
+    p = (LikeRangesT *) sqlite3_malloc(sizeof(LikeRangesT));
+    if ((z == 0) || (p == 0)) {
+        sqlite3_free(p);
+        sqlite3_result_error_nomem(context);
+        return;
+    }
+    like_ranges(p, z, sqlite3_value_bytes16(argv[0]) / 2, escape);
+    like_range_result(context, &p->aRange[upper ? p->nRange - 1 : 0], upper);
+    sqlite3_free(p);
+}
+
+/*
+** SELECT lo, hi FROM like_ranges(pattern [, esc]) returns the ranges, in
+** RMNOCASE order
+*/
+typedef struct likeRangesCursor_ {
+    sqlite3_vtab_cursor base;
+    LikeRangesT *pRanges;
+    int iRange;
+} LikeRangesCursorT;
+
+#define LIKE_RANGES_PATTERN     2
+#define LIKE_RANGES_ESCAPE      3
+
+SQLITE_PRIVATE int likeRangesConnect(
+    sqlite3 *db,
+    void *pAux,
+    int argc,
+    const char *const *argv,
+    sqlite3_vtab **ppVtab,
+    char **pzErr
+){
+    sqlite3_vtab *pVtab;
+    int rc;
+    UNUSED_PARAMETER(pAux);
+    UNUSED_PARAMETER(argc);
+    UNUSED_PARAMETER(argv);
+    UNUSED_PARAMETER(pzErr);
+    rc = sqlite3_declare_vtab(db, "CREATE TABLE x(lo, hi, pattern HIDDEN, esc HIDDEN)");
+    if (rc != SQLITE_OK) return rc;
+    pVtab = sqlite3_malloc(sizeof(*pVtab));
+    if (pVtab == 0) return SQLITE_NOMEM;
+    memset(pVtab, 0, sizeof(*pVtab));
+    *ppVtab = pVtab;
+    return SQLITE_OK;
+}
+
+SQLITE_PRIVATE int likeRangesDisconnect(sqlite3_vtab *pVtab){
+    sqlite3_free(pVtab);
+    return SQLITE_OK;
+}
+
+/*
+** idxNum is 1 with the pattern, 2 with the pattern and the escape
+*/
+SQLITE_PRIVATE int likeRangesBestIndex(
+    sqlite3_vtab *pVtab,
+    sqlite3_index_info *pInfo
+){
+    int i, iPattern = -1, iEscape = -1;
+    UNUSED_PARAMETER(pVtab);
+    for (i = 0; i < pInfo->nConstraint; i++) {
+        if (pInfo->aConstraint[i].op != SQLITE_INDEX_CONSTRAINT_EQ) continue;
+        if (pInfo->aConstraint[i].iColumn == LIKE_RANGES_PATTERN) {
+            if (!pInfo->aConstraint[i].usable) return SQLITE_CONSTRAINT;
+            iPattern = i;
+        } else if (pInfo->aConstraint[i].iColumn == LIKE_RANGES_ESCAPE) {
+            if (!pInfo->aConstraint[i].usable) return SQLITE_CONSTRAINT;
+            iEscape = i;
+        }
+    }
+    pInfo->idxNum = 0;
+    if (iPattern >= 0) {
+        pInfo->aConstraintUsage[iPattern].argvIndex = 1;
+        pInfo->aConstraintUsage[iPattern].omit = 1;
+        pInfo->idxNum = 1;
+        if (iEscape >= 0) {
+            pInfo->aConstraintUsage[iEscape].argvIndex = 2;
+            pInfo->aConstraintUsage[iEscape].omit = 1;
+            pInfo->idxNum = 2;
+        }
+    }
+    pInfo->estimatedCost = 10.0;
+    pInfo->estimatedRows = LIKE_BOUND_RANGES;
+    return SQLITE_OK;
+}
+
+SQLITE_PRIVATE int likeRangesOpen(
+    sqlite3_vtab *pVtab,
+    sqlite3_vtab_cursor **ppCursor
+){
+    LikeRangesCursorT *pCur = sqlite3_malloc(sizeof(*pCur));
+    UNUSED_PARAMETER(pVtab);
+    if (pCur == 0) return SQLITE_NOMEM;
+    memset(pCur, 0, sizeof(*pCur));
+    *ppCursor = &pCur->base;
+    return SQLITE_OK;
+}
+
+SQLITE_PRIVATE int likeRangesClose(sqlite3_vtab_cursor *pCursor){
+    sqlite3_free(((LikeRangesCursorT *) pCursor)->pRanges);
+    sqlite3_free(pCursor);
+    return SQLITE_OK;
+}
+
+SQLITE_PRIVATE int likeRangesFilter(
+    sqlite3_vtab_cursor *pCursor,
+    int idxNum,
+    const char *idxStr,
+    int argc,
+    sqlite3_value **argv
+){
+    LikeRangesCursorT *pCur = (LikeRangesCursorT *) pCursor;
+    const u16 *z;
+    u32 escape = 0;
+    UNUSED_PARAMETER(idxStr);
+    UNUSED_PARAMETER(argc);
+
+    sqlite3_free(pCur->pRanges);
+    pCur->pRanges = 0;
+    pCur->iRange = 0;
+    if (idxNum == 0) {
+        sqlite3_free(pCursor->pVtab->zErrMsg);
+        pCursor->pVtab->zErrMsg = sqlite3_mprintf("like_ranges: the pattern is required");
+        return SQLITE_ERROR;
+    }
+    if ((idxNum == 2) && (like_ranges_escape(argv[1], &escape, &pCursor->pVtab->zErrMsg) != SQLITE_OK)) {
+        return SQLITE_ERROR;
+    }
+    if (sqlite3_value_type(argv[0]) == SQLITE_NULL) return SQLITE_OK;
+    z = (const u16 *) sqlite3_value_text16(argv[0]);
+    pCur->pRanges = (LikeRangesT *) sqlite3_malloc(sizeof(LikeRangesT));
+    if ((z == 0) || (pCur->pRanges == 0)) return SQLITE_NOMEM;
+    like_ranges(pCur->pRanges, z, sqlite3_value_bytes16(argv[0]) / 2, escape);
+    return SQLITE_OK;
+}
+
+SQLITE_PRIVATE int likeRangesNext(sqlite3_vtab_cursor *pCursor){
+    ((LikeRangesCursorT *) pCursor)->iRange++;
+    return SQLITE_OK;
+}
+
+SQLITE_PRIVATE int likeRangesEof(sqlite3_vtab_cursor *pCursor){
+    LikeRangesCursorT *pCur = (LikeRangesCursorT *) pCursor;
+    return (pCur->pRanges == 0) || (pCur->iRange >= pCur->pRanges->nRange);
+}
+
+SQLITE_PRIVATE int likeRangesColumn(
+    sqlite3_vtab_cursor *pCursor,
+    sqlite3_context *context,
+    int i
+){
+    LikeRangesCursorT *pCur = (LikeRangesCursorT *) pCursor;
+    if (i < LIKE_RANGES_PATTERN) {
+        like_range_result(context, &pCur->pRanges->aRange[pCur->iRange], i);
+    }
+    return SQLITE_OK;
+}
+
+SQLITE_PRIVATE int likeRangesRowid(
+    sqlite3_vtab_cursor *pCursor,
+    sqlite3_int64 *pRowid
+){
+    *pRowid = ((LikeRangesCursorT *) pCursor)->iRange + 1;
+    return SQLITE_OK;
+}
+
+static sqlite3_module likeRangesModule = {
+    0,                          /* iVersion */
+    0,                          /* xCreate: eponymous only */
+    likeRangesConnect,
+    likeRangesBestIndex,
+    likeRangesDisconnect,
+    0,                          /* xDestroy */
+    likeRangesOpen,
+    likeRangesClose,
+    likeRangesFilter,
+    likeRangesNext,
+    likeRangesEof,
+    likeRangesColumn,
+    likeRangesRowid,
+    0, 0, 0, 0, 0, 0, 0         /* xUpdate ... xRename */
+};
+
+
+
+/*
+**==========================================================================================================
+**
+**          Index maintenance
+**
+**==========================================================================================================
+*/
+
+/*
+** Collations this extension registers.  Indexes using them were ordered by
+** whatever implementation of the collation was loaded when they were built.
+** The comparators take UTF-8 keys when the UTF-8 versions exist, UTF-16
+** ones otherwise: both give the same results.
+*/
+typedef int (*CollationCompareT)(void *, int, const void *, int, const void *);
+
+#ifdef UNIFUZZ_UTF8_COLLATION
+#define UNIFUZZ_COLLATION(zName, xCompare)  {zName, xCompare##8}
+#else
+#define UNIFUZZ_COLLATION(zName, xCompare)  {zName, xCompare}
+#endif
+
+static const struct {
+    const char *zName;
+    CollationCompareT xCompare;
+} unifuzz_collations[] = {
+#ifdef UNIFUZZ_OVERRIDE_NOCASE
+    UNIFUZZ_COLLATION("NOCASE", nocase_collate),
+    UNIFUZZ_COLLATION("RMNOCASE", nocase_collate),
+#else
+    UNIFUZZ_COLLATION("NOCASEU", nocase_collate),
+#endif
+    UNIFUZZ_COLLATION("NAMES", names_collate),
+    UNIFUZZ_COLLATION("UNACCENTED", unaccented_collate),
+    UNIFUZZ_COLLATION("NUMERICS", numerics_collate),
+    UNIFUZZ_COLLATION("NATURAL", natural_collate)
+};
+
+/*
+** Comparator of collation zName, or 0 if it isn't one of ours
+*/
+SQLITE_PRIVATE CollationCompareT unifuzz_collation(const char *zName){
+    int i;
+    if (zName == 0) return 0;
+    for (i = 0; i < (int) (sizeof(unifuzz_collations) / sizeof(unifuzz_collations[0])); i++) {
+        if (sqlite3_stricmp(zName, unifuzz_collations[i].zName) == 0) return unifuzz_collations[i].xCompare;
+    }
+    return 0;
+}
+
+/*
+** Prepares a statement listing table, index, collation name, uniqueness and
+** partialness of every index key column of schema zSchema that has a
+** collation, by table and index.  The caller keeps the columns for which
+** unifuzz_collation() finds a comparator.
+*/
+SQLITE_PRIVATE int collated_indexes_prepare(
+    sqlite3 *db,
+    const char *zSchema,
+    sqlite3_stmt **ppStmt
+){
+    int rc;
+    char *zSql = sqlite3_mprintf(
+        "SELECT s.name, l.name, x.coll, l.\"unique\", l.partial FROM \"%w\".sqlite_master AS s, "
+        "pragma_index_list(s.name, %Q) AS l, pragma_index_xinfo(l.name, %Q) AS x "
+        "WHERE s.type = 'table' AND x.key AND x.coll IS NOT NULL ORDER BY s.name, l.name",
+        zSchema, zSchema, zSchema);
+    if (zSql == 0) return SQLITE_NOMEM;
+    rc = sqlite3_prepare_v2(db, zSql, -1, ppStmt, 0);
+    sqlite3_free(zSql);
+    return rc;
+}
+
+
+/*
+** Fingerprint of the collation behaviour: the 64-bit FNV-1a of the unifuzz
+** and Unicode versions, the flags of the weight collations, whether NOCASE
+** is overridden, and what the collations look up for every code unit: its
+** collation element, its canonical code units and its NUMERICS class.  The
+** tables are hashed by content, so that a mere change of their layout keeps
+** the fingerprint.  Indexes built by any process with the same fingerprint
+** are in the order this one expects.  The case and accent tables don't take
+** part: no collation looks them up, so loading another table file doesn't
+** call for a REINDEX.
+**
+** The fingerprint of the last REINDEX is recorded by unifuzz_mark_reindexed()
+** in a unifuzz_meta table, of the database itself or of an attached one.  Only unifuzz's behaviour is
+** covered: rows written by another implementation of the collations, such as
+** RootsMagic's own RMNOCASE, may still be out of order.
+*/
+static sqlite3_uint64 collation_fingerprint = 0;
+static int collation_fingerprint_built = 0;
+
+/*
+** Computes the fingerprint, once per process, after numclass_build()
+*/
+SQLITE_PRIVATE void fingerprint_build(void){
+    sqlite3_mutex *mutex = sqlite3_mutex_alloc(SQLITE_MUTEX_STATIC_MASTER);
+    static const int flags[] = {
+        NOCASE_FLAGS, UNACCENTED_FLAGS, NAMES_FLAGS,
+#ifdef UNIFUZZ_OVERRIDE_NOCASE
+        1
+#else
+        0
+#endif
+    };
+    sqlite3_uint64 h = FINGERPRINT_BASIS;
+    u32 c;
+    u8 cls;
+
+    sqlite3_mutex_enter(mutex);
+    if (!collation_fingerprint_built) {
+        h = fingerprint_add(h, VERSION_STRINGS, (int) strlen(VERSION_STRINGS));
+        h = fingerprint_add(h, flags, (int) sizeof(flags));
+        h = fingerprint_add(h, coll_weights, (int) sizeof(coll_weights));
+        h = fingerprint_add(h, coll_canon, (int) sizeof(coll_canon));
+        for (c = 0; c < NUMCLASS_LIMIT; c++) {
+            cls = NUMCLASS(c);
+            h = fingerprint_add(h, &cls, 1);
+        }
+        collation_fingerprint = h;
+        collation_fingerprint_built = 1;
+    }
+    sqlite3_mutex_leave(mutex);
+}
+
+/*
+** Reads the fingerprint recorded under zName in schema zSchema into zHex
+** (17 bytes), or sets it to "" when there is none
+*/
+SQLITE_PRIVATE int fingerprint_read(
+    sqlite3 *db,
+    const char *zSchema,
+    const char *zName,
+    char *zHex
+){
+    sqlite3_stmt *pStmt;
+    int rc;
+    char *zSql = sqlite3_mprintf("SELECT 1 FROM \"%w\".sqlite_master WHERE type = 'table' AND name = 'unifuzz_meta'", zSchema);
+
+    zHex[0] = 0;
+    if (zSql == 0) return SQLITE_NOMEM;
+    rc = sqlite3_prepare_v2(db, zSql, -1, &pStmt, 0);
+    sqlite3_free(zSql);
+    if (rc != SQLITE_OK) return rc;
+    rc = sqlite3_step(pStmt);
+    sqlite3_finalize(pStmt);
+    if (rc != SQLITE_ROW) return (rc == SQLITE_DONE) ? SQLITE_OK : rc;
+
+    zSql = sqlite3_mprintf("SELECT value FROM \"%w\".unifuzz_meta WHERE name = %Q", zSchema, zName);
+    if (zSql == 0) return SQLITE_NOMEM;
+    rc = sqlite3_prepare_v2(db, zSql, -1, &pStmt, 0);
+    sqlite3_free(zSql);
+    if (rc != SQLITE_OK) return rc;
+    if ((rc = sqlite3_step(pStmt)) == SQLITE_ROW) {
+        const char *z = (const char *) sqlite3_column_text(pStmt, 0);
+        if (z && (strlen(z) == 16)) {
+            memcpy(zHex, z, 17);
+        }
+    }
+    sqlite3_finalize(pStmt);
+    return ((rc == SQLITE_ROW) || (rc == SQLITE_DONE)) ? SQLITE_OK : rc;
+}
+
+/*
+** unifuzz_fingerprint() returns the fingerprint of the loaded collations
+** as 16 hexadecimal digits
+*/
+SQLITE_PRIVATE void fingerprintFunc(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
+){
+    char zHex[17];
+    UNUSED_PARAMETER(argc);
+    UNUSED_PARAMETER(argv);
+    sqlite3_snprintf(sizeof(zHex), zHex, "%016llx", collation_fingerprint);
+    sqlite3_result_text(context, zHex, -1, SQLITE_TRANSIENT);
+}
+
+
+/*
+** unifuzz_needs_reindex([schema [, meta]]) returns 0 when the fingerprint
+** recorded in meta (schema by default, main by default) is the one of the
+** loaded collations, or when none of the indexes of schema uses them, and 1
+** otherwise
+*/
+SQLITE_PRIVATE void needsReindexFunc(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
+){
+    sqlite3 *db = sqlite3_context_db_handle(context);
+    const char *zSchema = (argc > 0) ? (const char *) sqlite3_value_text(argv[0]) : "main";
+    const char *zMeta = (argc > 1) ? (const char *) sqlite3_value_text(argv[1]) : zSchema;
+    sqlite3_stmt *pStmt;
+    char zHex[17], zRecorded[17];
+    int rc, needed = 0;
+
+    if ((zSchema == 0) || (zMeta == 0)) return;
+    rc = fingerprint_read(db, zMeta, "fingerprint", zRecorded);
+    if (rc == SQLITE_OK) {
+        sqlite3_snprintf(sizeof(zHex), zHex, "%016llx", collation_fingerprint);
+        if (strcmp(zHex, zRecorded) != 0) {
+            rc = collated_indexes_prepare(db, zSchema, &pStmt);
+            if (rc == SQLITE_OK) {
+                while (!needed && ((rc = sqlite3_step(pStmt)) == SQLITE_ROW)) {
+                    needed = (unifuzz_collation((const char *) sqlite3_column_text(pStmt, 2)) != 0);
+                }
+                sqlite3_finalize(pStmt);
+                if (rc == SQLITE_ROW || rc == SQLITE_DONE) rc = SQLITE_OK;
+            }
+        }
+    }
+    if (rc != SQLITE_OK) {
+        sqlite3_result_error(context, sqlite3_errmsg(db), -1);
+        return;
+    }
+    sqlite3_result_int(context, needed);
+}
+
+/*
+** unifuzz_mark_reindexed([schema [, meta]]) records the fingerprint of the
+** loaded collations in meta (schema by default, main by default), once the
+** indexes of schema have been rebuilt, and returns it
+*/
+SQLITE_PRIVATE void markReindexedFunc(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
+){
+    sqlite3 *db = sqlite3_context_db_handle(context);
+    const char *zSchema = (argc > 0) ? (const char *) sqlite3_value_text(argv[0]) : "main";
+    const char *zMeta = (argc > 1) ? (const char *) sqlite3_value_text(argv[1]) : zSchema;
+    char zHex[17], *zSql;
+    int rc;
+
+    if ((zSchema == 0) || (zMeta == 0)) return;
+    sqlite3_snprintf(sizeof(zHex), zHex, "%016llx", collation_fingerprint);
+    zSql = sqlite3_mprintf("CREATE TABLE IF NOT EXISTS \"%w\".unifuzz_meta(name TEXT PRIMARY KEY, value TEXT);"
+                           "INSERT OR REPLACE INTO \"%w\".unifuzz_meta(name, value) VALUES ('fingerprint', %Q);",
+                           zMeta, zMeta, zHex);
+    if (zSql == 0) {
+        sqlite3_result_error_nomem(context);
+        return;
+    }
+    rc = sqlite3_exec(db, zSql, 0, 0, 0);
+    sqlite3_free(zSql);
+    if (rc != SQLITE_OK) {
+        sqlite3_result_error(context, sqlite3_errmsg(db), -1);
+        return;
+    }
+    sqlite3_result_text(context, zHex, -1, SQLITE_TRANSIENT);
+}
+
+
+/*
+** Iterator over the indexes of a schema having at least one key column with
+** a unifuzz collation
+*/
+typedef struct collatedIndex_ {
+    sqlite3_stmt *pList;    /* from collated_indexes_prepare() */
+    char *zTable;
+    char *zIndex;
+    int unique;
+    int partial;
+} CollatedIndexT;
+
+SQLITE_PRIVATE int collated_index_first(
+    CollatedIndexT *p,
+    sqlite3 *db,
+    const char *zSchema
+){
+    memset(p, 0, sizeof(*p));
+    return collated_indexes_prepare(db, zSchema, &p->pList);
+}
+
+/*
+** Moves to the next index: returns SQLITE_ROW, SQLITE_DONE or an error
+*/
+SQLITE_PRIVATE int collated_index_next(CollatedIndexT *p){
+    const char *zIndex;
+    int rc;
+    while ((rc = sqlite3_step(p->pList)) == SQLITE_ROW) {
+        zIndex = (const char *) sqlite3_column_text(p->pList, 1);
+        if ((zIndex == 0) || (p->zIndex && (strcmp(zIndex, p->zIndex) == 0))) continue;
+        if (unifuzz_collation((const char *) sqlite3_column_text(p->pList, 2)) == 0) continue;
+        sqlite3_free(p->zTable);
+        sqlite3_free(p->zIndex);
+        p->zTable = sqlite3_mprintf("%s", sqlite3_column_text(p->pList, 0));
+        p->zIndex = sqlite3_mprintf("%s", zIndex);
+        if ((p->zTable == 0) || (p->zIndex == 0)) return SQLITE_NOMEM;
+        p->unique = sqlite3_column_int(p->pList, 3);
+        p->partial = sqlite3_column_int(p->pList, 4);
+        return SQLITE_ROW;
+    }
+    return rc;
+}
+
+SQLITE_PRIVATE void collated_index_finish(CollatedIndexT *p){
+    sqlite3_finalize(p->pList);
+    sqlite3_free(p->zTable);
+    sqlite3_free(p->zIndex);
+    memset(p, 0, sizeof(*p));
+}
+
+
+/*
+** Index order check
+**
+** An index is read in its own order by
+**
+**      SELECT k1, k2... FROM tbl INDEXED BY idx ORDER BY k1 COLLATE c1, k2...
+**
+** which the index satisfies without sorting, and each key is compared to
+** the previous one as SQLite would: NULL first, then numbers, text and
+** blobs, text with the collation of the column.  A key less than the
+** previous one, or equal to it in a UNIQUE index, is a violation.  That is
+** one compare per row, where a REINDEX sorts them all.
+**
+** Text is only compared with the unifuzz collations: a pair of keys is left
+** alone from the first column with another collation where they differ.
+** Indexes on expressions and partial indexes are skipped.
+*/
+typedef struct indexColumn_ {
+    CollationCompareT xCompare;     /* 0 for other collations */
+    int desc;
+    int type;                       /* of the value in the previous key */
+    sqlite3_int64 i;
+    double r;
+    int n;
+    int nAlloc;
+    u8 *z;                          /* text or blob of the previous key */
+} IndexColumnT;
+
+typedef struct indexCheck_ {
+    int skipped;                    /* expression or partial index */
+    sqlite3_int64 nRow;
+    sqlite3_int64 nViolation;
+    sqlite3_int64 iFirst;           /* position of the first violation, from 1, or 0 */
+    char *zFirst;                   /* its key as SQL literals */
+} IndexCheckT;
+
+#ifdef UNIFUZZ_UTF8_COLLATION
+#define INDEX_COLUMN_TEXT(pStmt, i)     sqlite3_column_text(pStmt, i)
+#define INDEX_COLUMN_BYTES(pStmt, i)    sqlite3_column_bytes(pStmt, i)
+#else
+#define INDEX_COLUMN_TEXT(pStmt, i)     sqlite3_column_text16(pStmt, i)
+#define INDEX_COLUMN_BYTES(pStmt, i)    sqlite3_column_bytes16(pStmt, i)
+#endif
+
+/*
+** Storage class rank in SQLite's order
+*/
+SQLITE_PRIVATE int index_type_rank(int type){
+    switch (type) {
+        case SQLITE_NULL:       return 0;
+        case SQLITE_INTEGER:
+        case SQLITE_FLOAT:      return 1;
+        case SQLITE_TEXT:       return 2;
+        default:                return 3;
+    }
+}
+
+/*
+** Compares the integer i to the real r exactly, as SQLite does: through the
+** integer part of r first, then its fraction, never rounding i to a double
+*/
+SQLITE_PRIVATE int index_int_real_compare(
+    sqlite3_int64 i,
+    double r
+){
+    sqlite3_int64 y;
+    double s;
+
+    if (r != r) return 1;                           // NaN
+    if (r < -9223372036854775808.0) return 1;
+    if (r >= 9223372036854775808.0) return -1;
+    y = (sqlite3_int64) r;
+    if (i != y) return (i < y) ? -1 : 1;
+    s = (double) i;
+    return (s < r) ? -1 : (s > r);
+}
+
+/*
+** Compares the previous key's value in p to column i of the current row:
+** returns -1, 0 or 1 in index order, or 2 when it can't tell
+*/
+SQLITE_PRIVATE int index_column_compare(
+    IndexColumnT *p,
+    sqlite3_stmt *pStmt,
+    int i
+){
+    int type = sqlite3_column_type(pStmt, i);
+    int c, r1 = index_type_rank(p->type), r2 = index_type_rank(type);
+    const void *z;
+    int n;
+
+    if (r1 != r2) {
+        c = (r1 < r2) ? -1 : 1;
+    } else if (r1 == 0) {
+        c = 0;
+    } else if (r1 == 1) {
+        if ((p->type == SQLITE_INTEGER) && (type == SQLITE_INTEGER)) {
+            sqlite3_int64 v = sqlite3_column_int64(pStmt, i);
+            c = (p->i < v) ? -1 : (p->i > v);
+        } else if (p->type == SQLITE_INTEGER) {
+            c = index_int_real_compare(p->i, sqlite3_column_double(pStmt, i));
+        } else if (type == SQLITE_INTEGER) {
+            c = -index_int_real_compare(sqlite3_column_int64(pStmt, i), p->r);
+        } else {
+            double v = sqlite3_column_double(pStmt, i);
+            c = (p->r < v) ? -1 : (p->r > v);
+        }
+    } else if (r1 == 2) {
+        z = INDEX_COLUMN_TEXT(pStmt, i);
+        n = INDEX_COLUMN_BYTES(pStmt, i);
+        if ((n == p->n) && (memcmp(p->z, z, n) == 0)) {
+            c = 0;
+        } else if (p->xCompare) {
+            c = p->xCompare(0, p->n, p->z, n, z);
+            c = (c > 0) - (c < 0);
+        } else {
+            return 2;
+        }
+    } else {
+        z = sqlite3_column_blob(pStmt, i);
+        n = sqlite3_column_bytes(pStmt, i);
+        c = memcmp(p->z, z, min(n, p->n));
+        c = c ? ((c > 0) - (c < 0)) : (p->n > n) - (p->n < n);
+    }
+    return p->desc ? -c : c;
+}
+
+/*
+** Keeps column i of the current row in p for the next compare
+*/
+SQLITE_PRIVATE int index_column_keep(
+    IndexColumnT *p,
+    sqlite3_stmt *pStmt,
+    int i
+){
+    const void *z = 0;
+    p->type = sqlite3_column_type(pStmt, i);
+    p->n = 0;
+    if (p->type == SQLITE_INTEGER) {
+        p->i = sqlite3_column_int64(pStmt, i);
+    } else if (p->type == SQLITE_FLOAT) {
+        p->r = sqlite3_column_double(pStmt, i);
+    } else if (p->type == SQLITE_TEXT) {
+        z = INDEX_COLUMN_TEXT(pStmt, i);
+        p->n = INDEX_COLUMN_BYTES(pStmt, i);
+    } else if (p->type == SQLITE_BLOB) {
+        z = sqlite3_column_blob(pStmt, i);
+        p->n = sqlite3_column_bytes(pStmt, i);
+    }
+    if (p->n > p->nAlloc) {
+        u8 *zNew = sqlite3_realloc(p->z, 2 * p->n);
+        if (zNew == 0) return SQLITE_NOMEM;
+        p->z = zNew;
+        p->nAlloc = 2 * p->n;
+    }
+    if (p->n) memcpy(p->z, z, p->n);
+    return SQLITE_OK;
+}
+
+/*
+** The key of the current row as SQL literals
+*/
+SQLITE_PRIVATE char *index_key_text(
+    sqlite3_stmt *pStmt,
+    int nCol
+){
+    sqlite3_str *pStr = sqlite3_str_new(0);
+    int i, j, n;
+    const u8 *z;
+    for (i = 0; i < nCol; i++) {
+        if (i) sqlite3_str_appendall(pStr, ", ");
+        switch (sqlite3_column_type(pStmt, i)) {
+            case SQLITE_NULL:
+                sqlite3_str_appendall(pStr, "NULL");
+                break;
+            case SQLITE_INTEGER:
+                sqlite3_str_appendf(pStr, "%lld", sqlite3_column_int64(pStmt, i));
+                break;
+            case SQLITE_FLOAT:
+                sqlite3_str_appendf(pStr, "%!.15g", sqlite3_column_double(pStmt, i));
+                break;
+            case SQLITE_TEXT:
+                sqlite3_str_appendf(pStr, "%Q", sqlite3_column_text(pStmt, i));
+                break;
+            default:
+                z = (const u8 *) sqlite3_column_blob(pStmt, i);
+                n = sqlite3_column_bytes(pStmt, i);
+                sqlite3_str_appendall(pStr, "x'");
+                for (j = 0; j < n; j++) {
+                    sqlite3_str_appendf(pStr, "%02x", z[j]);
+                }
+                sqlite3_str_appendall(pStr, "'");
+        }
+    }
+    return sqlite3_str_finish(pStr);
+}
+
+/*
+** Checks the order of index zIndex of table zTable in schema zSchema
+*/
+SQLITE_PRIVATE int index_check(
+    sqlite3 *db,
+    const char *zSchema,
+    const CollatedIndexT *pIndex,
+    IndexCheckT *pCheck
+){
+    sqlite3_stmt *pStmt = 0;
+    sqlite3_str *pSql;
+    IndexColumnT *aCol = 0;
+    char *zSql;
+    int i, c = 0, nCol = 0, rc, equal, hasNull;
+
+    sqlite3_free(pCheck->zFirst);
+    memset(pCheck, 0, sizeof(*pCheck));
+    if (pIndex->partial) {
+        pCheck->skipped = 1;
+        return SQLITE_OK;
+    }
+
+    zSql = sqlite3_mprintf("SELECT name, coll, desc FROM pragma_index_xinfo(%Q, %Q) WHERE key ORDER BY seqno",
+                           pIndex->zIndex, zSchema);
+    if (zSql == 0) return SQLITE_NOMEM;
+    rc = sqlite3_prepare_v2(db, zSql, -1, &pStmt, 0);
+    sqlite3_free(zSql);
+    if (rc != SQLITE_OK) return rc;
+    pSql = sqlite3_str_new(db);
+    sqlite3_str_appendall(pSql, "SELECT ");
+    while ((rc = sqlite3_step(pStmt)) == SQLITE_ROW) {
+        const char *zCol = (const char *) sqlite3_column_text(pStmt, 0);
+        if (zCol == 0) {
+            pCheck->skipped = 1;
+            break;
+        }
+        sqlite3_str_appendf(pSql, "%s\"%w\"", nCol ? ", " : "", zCol);
+        nCol++;
+    }
+    if (rc == SQLITE_ROW) rc = SQLITE_DONE;
+    if ((rc == SQLITE_DONE) && !pCheck->skipped) {
+        aCol = sqlite3_malloc(nCol * sizeof(IndexColumnT));
+        if (aCol == 0) rc = SQLITE_NOMEM;
+    }
+    if ((rc != SQLITE_DONE) || pCheck->skipped) {
+        sqlite3_finalize(pStmt);
+        sqlite3_free(sqlite3_str_finish(pSql));
+        return (rc == SQLITE_DONE) ? SQLITE_OK : rc;
+    }
+    memset(aCol, 0, nCol * sizeof(IndexColumnT));
+    sqlite3_str_appendf(pSql, " FROM \"%w\".\"%w\" INDEXED BY \"%w\" ORDER BY ", zSchema, pIndex->zTable, pIndex->zIndex);
+    sqlite3_reset(pStmt);
+    for (i = 0; sqlite3_step(pStmt) == SQLITE_ROW; i++) {
+        aCol[i].xCompare = unifuzz_collation((const char *) sqlite3_column_text(pStmt, 1));
+        aCol[i].desc = sqlite3_column_int(pStmt, 2);
+        sqlite3_str_appendf(pSql, "%s\"%w\" COLLATE \"%w\"%s", i ? ", " : "", sqlite3_column_text(pStmt, 0),
+                            sqlite3_column_text(pStmt, 1), aCol[i].desc ? " DESC" : "");
+    }
+    sqlite3_finalize(pStmt);
+    zSql = sqlite3_str_finish(pSql);
+    if (zSql == 0) {
+        sqlite3_free(aCol);
+        return SQLITE_NOMEM;
+    }
+    rc = sqlite3_prepare_v2(db, zSql, -1, &pStmt, 0);
+    sqlite3_free(zSql);
+
+    while ((rc == SQLITE_OK) && (sqlite3_step(pStmt) == SQLITE_ROW)) {
+        pCheck->nRow++;
+        if (pCheck->nRow > 1) {
+            equal = 1;
+            hasNull = 0;
+            for (i = 0; i < nCol; i++) {
+                hasNull |= (aCol[i].type == SQLITE_NULL);
+                c = index_column_compare(&aCol[i], pStmt, i);
+                if (c != 0) {
+                    equal = 0;
+                    break;
+                }
+            }
+            if ((c == 1) || (equal && pIndex->unique && !hasNull)) {
+                if (pCheck->nViolation++ == 0) {
+                    pCheck->iFirst = pCheck->nRow;
+                    pCheck->zFirst = index_key_text(pStmt, nCol);
+                }
+            }
+        }
+        for (i = 0; (i < nCol) && (rc == SQLITE_OK); i++) {
+            rc = index_column_keep(&aCol[i], pStmt, i);
+        }
+    }
+    if (rc == SQLITE_OK) rc = sqlite3_finalize(pStmt);
+    else sqlite3_finalize(pStmt);
+    for (i = 0; i < nCol; i++) {
+        sqlite3_free(aCol[i].z);
+    }
+    sqlite3_free(aCol);
+    return rc;
+}
+
+
+/*
+** unifuzz_check_indexes([schema]) is a table-valued function checking, one
+** at a time, the order of the indexes of schema (main by default) that use
+** a unifuzz collation: table, index, rows, violations, position and key of
+** the first violation.  rows is null for skipped indexes.
+*/
+typedef struct checkIndexesVtab_ {
+    sqlite3_vtab base;
+    sqlite3 *db;
+} CheckIndexesVtabT;
+
+typedef struct checkIndexesCursor_ {
+    sqlite3_vtab_cursor base;
+    sqlite3 *db;
+    char *zSchema;
+    CollatedIndexT index;
+    IndexCheckT check;
+    sqlite3_int64 iRowid;
+    int eof;
+} CheckIndexesCursorT;
+
+#define CHECK_INDEXES_SCHEMA    6
+
+SQLITE_PRIVATE int checkIndexesConnect(
+    sqlite3 *db,
+    void *pAux,
+    int argc,
+    const char *const *argv,
+    sqlite3_vtab **ppVtab,
+    char **pzErr
+){
+    CheckIndexesVtabT *pVtab;
+    int rc;
+    UNUSED_PARAMETER(pAux);
+    UNUSED_PARAMETER(argc);
+    UNUSED_PARAMETER(argv);
+    UNUSED_PARAMETER(pzErr);
+    rc = sqlite3_declare_vtab(db, "CREATE TABLE x(tbl TEXT, idx TEXT, rows INTEGER, violations INTEGER, "
+                                  "first_row INTEGER, first_key TEXT, schema HIDDEN)");
+    if (rc != SQLITE_OK) return rc;
+    pVtab = sqlite3_malloc(sizeof(*pVtab));
+    if (pVtab == 0) return SQLITE_NOMEM;
+    memset(pVtab, 0, sizeof(*pVtab));
+    pVtab->db = db;
+    *ppVtab = &pVtab->base;
+    return SQLITE_OK;
+}
+
+SQLITE_PRIVATE int checkIndexesDisconnect(sqlite3_vtab *pVtab){
+    sqlite3_free(pVtab);
+    return SQLITE_OK;
+}
+
+SQLITE_PRIVATE int checkIndexesBestIndex(
+    sqlite3_vtab *pVtab,
+    sqlite3_index_info *pInfo
+){
+    int i;
+    UNUSED_PARAMETER(pVtab);
+    pInfo->idxNum = 0;
+    for (i = 0; i < pInfo->nConstraint; i++) {
+        if ((pInfo->aConstraint[i].iColumn == CHECK_INDEXES_SCHEMA) && (pInfo->aConstraint[i].op == SQLITE_INDEX_CONSTRAINT_EQ)) {
+            if (!pInfo->aConstraint[i].usable) return SQLITE_CONSTRAINT;
+            pInfo->aConstraintUsage[i].argvIndex = 1;
+            pInfo->aConstraintUsage[i].omit = 1;
+            pInfo->idxNum = 1;
+        }
+    }
+    pInfo->estimatedCost = 1000000.0;
+    return SQLITE_OK;
+}
+
+SQLITE_PRIVATE int checkIndexesOpen(
+    sqlite3_vtab *pVtab,
+    sqlite3_vtab_cursor **ppCursor
+){
+    CheckIndexesCursorT *pCur = sqlite3_malloc(sizeof(*pCur));
+    if (pCur == 0) return SQLITE_NOMEM;
+    memset(pCur, 0, sizeof(*pCur));
+    pCur->db = ((CheckIndexesVtabT *) pVtab)->db;
+    *ppCursor = &pCur->base;
+    return SQLITE_OK;
+}
+
+SQLITE_PRIVATE void checkIndexesReset(CheckIndexesCursorT *pCur){
+    collated_index_finish(&pCur->index);
+    sqlite3_free(pCur->check.zFirst);
+    memset(&pCur->check, 0, sizeof(pCur->check));
+    sqlite3_free(pCur->zSchema);
+    pCur->zSchema = 0;
+}
+
+SQLITE_PRIVATE int checkIndexesClose(sqlite3_vtab_cursor *pCursor){
+    checkIndexesReset((CheckIndexesCursorT *) pCursor);
+    sqlite3_free(pCursor);
+    return SQLITE_OK;
+}
+
+SQLITE_PRIVATE int checkIndexesNext(sqlite3_vtab_cursor *pCursor){
+    CheckIndexesCursorT *pCur = (CheckIndexesCursorT *) pCursor;
+    int rc = collated_index_next(&pCur->index);
+    if (rc == SQLITE_ROW) {
+        rc = index_check(pCur->db, pCur->zSchema, &pCur->index, &pCur->check);
+        pCur->iRowid++;
+    } else if (rc == SQLITE_DONE) {
+        pCur->eof = 1;
+        rc = SQLITE_OK;
+    }
+    if (rc != SQLITE_OK) {
+        sqlite3_free(pCursor->pVtab->zErrMsg);
+        pCursor->pVtab->zErrMsg = sqlite3_mprintf("%s", sqlite3_errmsg(pCur->db));
+    }
+    return rc;
+}
+
+SQLITE_PRIVATE int checkIndexesFilter(
+    sqlite3_vtab_cursor *pCursor,
+    int idxNum,
+    const char *idxStr,
+    int argc,
+    sqlite3_value **argv
+){
+    CheckIndexesCursorT *pCur = (CheckIndexesCursorT *) pCursor;
+    const char *zSchema = "main";
+    int rc;
+    UNUSED_PARAMETER(idxStr);
+    UNUSED_PARAMETER(argc);
+
+    checkIndexesReset(pCur);
+    if (idxNum) {
+        zSchema = (const char *) sqlite3_value_text(argv[0]);
+        if (zSchema == 0) {
+            pCur->eof = 1;
+            return SQLITE_OK;
+        }
+    }
+    pCur->zSchema = sqlite3_mprintf("%s", zSchema);
+    if (pCur->zSchema == 0) return SQLITE_NOMEM;
+    pCur->eof = 0;
+    pCur->iRowid = 0;
+    rc = collated_index_first(&pCur->index, pCur->db, pCur->zSchema);
+    if (rc != SQLITE_OK) {
+        sqlite3_free(pCursor->pVtab->zErrMsg);
+        pCursor->pVtab->zErrMsg = sqlite3_mprintf("%s", sqlite3_errmsg(pCur->db));
+        return rc;
+    }
+    return checkIndexesNext(pCursor);
+}
+
+SQLITE_PRIVATE int checkIndexesEof(sqlite3_vtab_cursor *pCursor){
+    return ((CheckIndexesCursorT *) pCursor)->eof;
+}
+
+SQLITE_PRIVATE int checkIndexesColumn(
+    sqlite3_vtab_cursor *pCursor,
+    sqlite3_context *context,
+    int i
+){
+    CheckIndexesCursorT *pCur = (CheckIndexesCursorT *) pCursor;
+    switch (i) {
+        case 0:
+            sqlite3_result_text(context, pCur->index.zTable, -1, SQLITE_TRANSIENT);
+            break;
+        case 1:
+            sqlite3_result_text(context, pCur->index.zIndex, -1, SQLITE_TRANSIENT);
+            break;
+        case 2:
+            if (!pCur->check.skipped) sqlite3_result_int64(context, pCur->check.nRow);
+            break;
+        case 3:
+            if (!pCur->check.skipped) sqlite3_result_int64(context, pCur->check.nViolation);
+            break;
+        case 4:
+            if (pCur->check.iFirst) sqlite3_result_int64(context, pCur->check.iFirst);
+            break;
+        case 5:
+            if (pCur->check.zFirst) sqlite3_result_text(context, pCur->check.zFirst, -1, SQLITE_TRANSIENT);
+            break;
+        default:
+            sqlite3_result_text(context, pCur->zSchema, -1, SQLITE_TRANSIENT);
+    }
+    return SQLITE_OK;
+}
 
-    return CompareStringW(LOCALE_INVARIANT, NORM_IGNORECASE | NORM_IGNOREWIDTH | NORM_IGNOREKANATYPE | SORT_STRINGSORT, (u16 *) pKey1, l1, (u16 *) pKey2, l2) - 2;
+SQLITE_PRIVATE int checkIndexesRowid(
+    sqlite3_vtab_cursor *pCursor,
+    sqlite3_int64 *pRowid
+){
+    *pRowid = ((CheckIndexesCursorT *) pCursor)->iRowid;
+    return SQLITE_OK;
 }
 
+static sqlite3_module checkIndexesModule = {
+    0,                          /* iVersion */
+    0,                          /* xCreate: eponymous only */
+    checkIndexesConnect,
+    checkIndexesBestIndex,
+    checkIndexesDisconnect,
+    0,                          /* xDestroy */
+    checkIndexesOpen,
+    checkIndexesClose,
+    checkIndexesFilter,
+    checkIndexesNext,
+    checkIndexesEof,
+    checkIndexesColumn,
+    checkIndexesRowid,
+    0, 0, 0, 0, 0, 0, 0         /* xUpdate ... xRename */
+};
+
 
 /*
-** This collation uses a Windows function, UTF-16LE is mandatory
-** similar to the above but ignores diacritics
+** unifuzz_reindex_failing([schema]) checks the indexes of schema (main by
+** default) using a unifuzz collation and rebuilds those out of order.
+** Returns how many it rebuilt.
 */
-
-SQLITE_PRIVATE int unaccented_collate(
-    void *encoding,
-    int nKey1,
-    const void *pKey1,
-    int nKey2,
-    const void *pKey2
+SQLITE_PRIVATE void reindexFailingFunc(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
 ){
-    int l1, l2;
-    UNUSED_PARAMETER(encoding);
-    l1 = Utf16CharLen((u16 *) pKey1, nKey1);
-    l2 = Utf16CharLen((u16 *) pKey2, nKey2);
+    sqlite3 *db = sqlite3_context_db_handle(context);
+    const char *zSchema = (argc > 0) ? (const char *) sqlite3_value_text(argv[0]) : "main";
+    CollatedIndexT index;
+    IndexCheckT check;
+    sqlite3_str *pSql;
+    char *zSql;
+    int rc, nFailing = 0;
+
+    if (zSchema == 0) return;
+    memset(&check, 0, sizeof(check));
+    pSql = sqlite3_str_new(db);
+    rc = collated_index_first(&index, db, zSchema);
+    while ((rc == SQLITE_OK) && ((rc = collated_index_next(&index)) == SQLITE_ROW)) {
+        rc = index_check(db, zSchema, &index, &check);
+        if ((rc == SQLITE_OK) && (check.nViolation > 0)) {
+            sqlite3_str_appendf(pSql, "REINDEX \"%w\".\"%w\";", zSchema, index.zIndex);
+            nFailing++;
+        }
+    }
+    collated_index_finish(&index);
+    sqlite3_free(check.zFirst);
+    zSql = sqlite3_str_finish(pSql);
+    if (rc == SQLITE_DONE) {
+        rc = (zSql || (nFailing == 0)) ? SQLITE_OK : SQLITE_NOMEM;
+        if (zSql && (rc == SQLITE_OK)) rc = sqlite3_exec(db, zSql, 0, 0, 0);
+    }
+    sqlite3_free(zSql);
+    if (rc == SQLITE_NOMEM) {
+        sqlite3_result_error_nomem(context);
+    } else if (rc != SQLITE_OK) {
+        sqlite3_result_error(context, sqlite3_errmsg(db), -1);
+    } else {
+        sqlite3_result_int(context, nFailing);
+    }
+}
 
-    return CompareStringW(LOCALE_INVARIANT, NORM_IGNORECASE | NORM_IGNORENONSPACE | NORM_IGNOREWIDTH | NORM_IGNOREKANATYPE | SORT_STRINGSORT, (u16 *) pKey1, l1, (u16 *) pKey2, l2) - 2;
+
+/*
+** Throttled REINDEX
+**
+** REINDEX RMNOCASE rebuilds every index using the collation in a single
+** write transaction.  unifuzz_reindex(target, budget_ms) rebuilds the
+** indexes of target, an index or a collation of schema main, one at a time
+** and returns once budget_ms have passed, with the number of indexes left
+** to rebuild.  Each call is a statement of its own, hence in autocommit
+** mode a transaction of its own: calling it again until it returns 0 lets
+** the readers and writers of other connections in between.  An index is
+** never split, so a call lasts at least as long as its next index takes.
+**
+** The plan of the connection is kept between calls, along with the rows
+** rebuilt and the time spent, from which unifuzz_reindex_status() reports
+** rows per second and the estimated time left.  SQLite's progress handler
+** is a single slot per connection that can't be chained, so it is left to
+** the application.
+*/
+typedef struct reindexPlan_ {
+    int nRef;               /* registrations using this plan */
+    char *zTarget;          /* 0 without a plan */
+    int nIndex;
+    int iNext;              /* next index to rebuild */
+    char **azIndex;
+    sqlite3_int64 *anRow;   /* rows of the table of each index */
+    sqlite3_int64 nRowTotal;
+    sqlite3_int64 nRowDone;
+    sqlite3_int64 msSpent;  /* time spent rebuilding */
+} ReindexPlanT;
+
+SQLITE_PRIVATE void reindex_plan_clear(ReindexPlanT *p){
+    int i;
+    for (i = 0; i < p->nIndex; i++) {
+        sqlite3_free(p->azIndex[i]);
+    }
+    sqlite3_free(p->azIndex);
+    sqlite3_free(p->anRow);
+    sqlite3_free(p->zTarget);
+    p->zTarget = 0;
+    p->azIndex = 0;
+    p->anRow = 0;
+    p->nIndex = p->iNext = 0;
+    p->nRowTotal = p->nRowDone = p->msSpent = 0;
 }
 
+SQLITE_PRIVATE void reindex_plan_release(void *pArg){
+    ReindexPlanT *p = (ReindexPlanT *) pArg;
+    if (--p->nRef == 0) {
+        reindex_plan_clear(p);
+        sqlite3_free(p);
+    }
+}
 
 /*
-** This collation uses a Windows function, UTF-16LE is mandatory
-** similar to the above but also ignores hyphens and apostrophes, symbols and punctuation
+** Milliseconds from the clock of the default VFS
 */
+SQLITE_PRIVATE sqlite3_int64 reindex_clock(void){
+    sqlite3_vfs *pVfs = sqlite3_vfs_find(0);
+    sqlite3_int64 t = 0;
+    double r;
+    if (pVfs == 0) return 0;
+    if ((pVfs->iVersion >= 2) && pVfs->xCurrentTimeInt64) {
+        pVfs->xCurrentTimeInt64(pVfs, &t);
+    } else {
+        pVfs->xCurrentTime(pVfs, &r);
+        t = (sqlite3_int64) (r * 86400000.0);
+    }
+    return t;
+}
 
-SQLITE_PRIVATE int names_collate(
-    void *encoding,
-    int nKey1,
-    const void *pKey1,
-    int nKey2,
-    const void *pKey2
+SQLITE_PRIVATE int reindex_plan_add(
+    ReindexPlanT *p,
+    const char *zIndex,
+    sqlite3_int64 nRow
 ){
-    int l1, l2;
-    UNUSED_PARAMETER(encoding);
-    l1 = Utf16CharLen((u16 *) pKey1, nKey1);
-    l2 = Utf16CharLen((u16 *) pKey2, nKey2);
-
-    return CompareStringW(LOCALE_INVARIANT, NORM_IGNORECASE | NORM_IGNORENONSPACE | NORM_IGNORESYMBOLS | NORM_IGNOREWIDTH | NORM_IGNOREKANATYPE, (u16 *) pKey1, l1, (u16 *) pKey2, l2) - 2;
+    char **azIndex = sqlite3_realloc(p->azIndex, (p->nIndex + 1) * sizeof(char *));
+    sqlite3_int64 *anRow;
+    if (azIndex == 0) return SQLITE_NOMEM;
+    p->azIndex = azIndex;
+    anRow = sqlite3_realloc(p->anRow, (p->nIndex + 1) * sizeof(sqlite3_int64));
+    if (anRow == 0) return SQLITE_NOMEM;
+    p->anRow = anRow;
+    p->azIndex[p->nIndex] = sqlite3_mprintf("%s", zIndex);
+    if (p->azIndex[p->nIndex] == 0) return SQLITE_NOMEM;
+    p->anRow[p->nIndex++] = nRow;
+    p->nRowTotal += nRow;
+    return SQLITE_OK;
 }
 
+SQLITE_PRIVATE int reindex_count_rows(
+    sqlite3 *db,
+    const char *zTable,
+    sqlite3_int64 *pnRow
+){
+    sqlite3_stmt *pStmt;
+    char *zSql = sqlite3_mprintf("SELECT count(*) FROM \"main\".\"%w\"", zTable);
+    int rc;
+    if (zSql == 0) return SQLITE_NOMEM;
+    rc = sqlite3_prepare_v2(db, zSql, -1, &pStmt, 0);
+    sqlite3_free(zSql);
+    if (rc != SQLITE_OK) return rc;
+    *pnRow = (sqlite3_step(pStmt) == SQLITE_ROW) ? sqlite3_column_int64(pStmt, 0) : 0;
+    return sqlite3_finalize(pStmt);
+}
 
 /*
-** UTF-16 version of _atoi64
-** updates the running pointer p so that it points either to past the end of string
-** or the first character after the numeric prefix
+** Lists the indexes of zTarget, an index or a collation of schema main
 */
-SQLITE_PRIVATE i64 utf16_atoi64(
-	const u16 **p,
-	int len
+SQLITE_PRIVATE int reindex_plan_make(
+    ReindexPlanT *p,
+    sqlite3 *db,
+    const char *zTarget
 ){
-    const u16 *q, *pTerm = &(((u16 *) *p)[len / sizeof(u16)]);
-    i64 value = 0;
-    u32 uc;
-    int i, isnumber, lead0, n, sign = 1;
-    if (len == 0) return 0;
-    while (*p < pTerm) {    /* skip any whitespace */
-        q = *p;
-        READ_UTF16((*p), pTerm, uc);
-        for (i = 0; i < sizeof(space_table) / sizeof(SpacingT); i++) {
-            if (uc < space_table[i].lo) {
-                *p = q;  // position back the pointer at the first non-whitespace character
-                break;
-            } else if (uc <= space_table[i].hi) {
-                uc = 0;
-                break;
-            }
+    sqlite3_stmt *pStmt;
+    char *zTable = 0;
+    const char *zIndex;
+    sqlite3_int64 nRow = 0;
+    int rc;
+
+    reindex_plan_clear(p);
+    p->zTarget = sqlite3_mprintf("%s", zTarget);
+    if (p->zTarget == 0) return SQLITE_NOMEM;
+    rc = sqlite3_prepare_v2(db, "SELECT tbl_name, name FROM \"main\".sqlite_master WHERE type = 'index'", -1, &pStmt, 0);
+    if (rc != SQLITE_OK) return rc;
+    while (sqlite3_step(pStmt) == SQLITE_ROW) {
+        if (sqlite3_stricmp((const char *) sqlite3_column_text(pStmt, 1), zTarget) == 0) {
+            rc = reindex_count_rows(db, (const char *) sqlite3_column_text(pStmt, 0), &nRow);
+            if (rc == SQLITE_OK) rc = reindex_plan_add(p, (const char *) sqlite3_column_text(pStmt, 1), nRow);
+            sqlite3_finalize(pStmt);
+            return rc;
         }
-        if (uc) break;  /* uc is not a whitespace */
-    }
-    if (*p < pTerm) {
-        q = *p;
-        READ_UTF16((*p), pTerm, uc);
-        for (i = 0; i < sizeof(sign_table) / sizeof(SignT); i++) { /* is uc a minus sign? */
-            if (uc < sign_table[i].codepoint) {
-                *p = q;  // position back the pointer at the first non-sign character
-                break;
-            } else if (uc == sign_table[i].codepoint) {
-                sign = sign_table[i].sign;
-                break;
-            }
+    }
+    sqlite3_finalize(pStmt);
+
+    rc = collated_indexes_prepare(db, "main", &pStmt);
+    while ((rc == SQLITE_OK) && (sqlite3_step(pStmt) == SQLITE_ROW)) {
+        zIndex = (const char *) sqlite3_column_text(pStmt, 1);
+        if (sqlite3_stricmp((const char *) sqlite3_column_text(pStmt, 2), zTarget) != 0) continue;
+        if (p->nIndex && (strcmp(p->azIndex[p->nIndex - 1], zIndex) == 0)) continue;
+        if ((zTable == 0) || (strcmp(zTable, (const char *) sqlite3_column_text(pStmt, 0)) != 0)) {
+            sqlite3_free(zTable);
+            zTable = sqlite3_mprintf("%s", sqlite3_column_text(pStmt, 0));
+            if (zTable == 0) rc = SQLITE_NOMEM;
+            else rc = reindex_count_rows(db, zTable, &nRow);
         }
+        if (rc == SQLITE_OK) rc = reindex_plan_add(p, zIndex, nRow);
     }
-    isnumber = 1;  /* read digits, if any */
-    lead0 = 1;
-    while (isnumber && (*p < pTerm)) {
-        q = *p;
-        READ_UTF16((*p), pTerm, uc);
-        for (i = 0; i < sizeof(numeric_table) / sizeof(NumericT); i++) {
-            if (uc < numeric_table[i].lo) {
-                isnumber = 0;
-                *p = q;  // position back the pointer at the first non-numeric character
-                break;
-            } else if (uc <= numeric_table[i].hi) {
-                n = numeric_table[i].digit + (u8) (uc - numeric_table[i].lo);
-                if (! ((n == '0') && (lead0))) {
-                    value = 10 * value + n;     // do not check for overflow
-                    lead0 = 0;
-                }
-                break;
-            }
+    sqlite3_finalize(pStmt);
+    sqlite3_free(zTable);
+    return rc;
+}
+
+/*
+** unifuzz_reindex(target [, budget_ms]) rebuilds the indexes of target, an
+** index or a collation, one at a time until budget_ms have passed (all of
+** them when it's omitted or not positive), and returns how many are left.
+** A call after the last one, or with another target, starts a new plan, and
+** so does a call after an error: the plan is dropped, and the indexes that
+** are left are listed again from the schema as it is then.
+*/
+SQLITE_PRIVATE void reindexFunc(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
+){
+    ReindexPlanT *p = (ReindexPlanT *) sqlite3_user_data(context);
+    sqlite3 *db = sqlite3_context_db_handle(context);
+    const char *zTarget = (const char *) sqlite3_value_text(argv[0]);
+    sqlite3_int64 msBudget = (argc > 1) ? sqlite3_value_int64(argv[1]) : 0;
+    sqlite3_int64 msStart, msIndex;
+    char *zSql;
+    int rc = SQLITE_OK;
+
+    if (zTarget == 0) return;
+    msStart = reindex_clock();
+    if ((p->zTarget == 0) || (p->iNext == p->nIndex) || (strcmp(p->zTarget, zTarget) != 0)) {
+        rc = reindex_plan_make(p, db, zTarget);
+        if ((rc == SQLITE_OK) && (p->nIndex == 0)) {
+            char *zErr = sqlite3_mprintf("unifuzz_reindex: no index or collation named %s in main", zTarget);
+            reindex_plan_clear(p);
+            sqlite3_result_error(context, zErr, -1);
+            sqlite3_free(zErr);
+            return;
+        }
+    }
+    while ((rc == SQLITE_OK) && (p->iNext < p->nIndex)) {
+        msIndex = reindex_clock();
+        zSql = sqlite3_mprintf("REINDEX \"main\".\"%w\"", p->azIndex[p->iNext]);
+        if (zSql == 0) {
+            rc = SQLITE_NOMEM;
+            break;
         }
+        rc = sqlite3_exec(db, zSql, 0, 0, 0);
+        sqlite3_free(zSql);
+        if (rc != SQLITE_OK) break;
+        p->msSpent += reindex_clock() - msIndex;
+        p->nRowDone += p->anRow[p->iNext++];
+        if ((msBudget > 0) && (reindex_clock() - msStart >= msBudget)) break;
+    }
+    if (rc != SQLITE_OK) {
+        reindex_plan_clear(p);
+    }
+    if (rc == SQLITE_NOMEM) {
+        sqlite3_result_error_nomem(context);
+    } else if (rc != SQLITE_OK) {
+        sqlite3_result_error(context, sqlite3_errmsg(db), -1);
+    } else {
+        sqlite3_result_int(context, p->nIndex - p->iNext);
     }
-    return value * sign;
 }
 
+/*
+** unifuzz_reindex_status() reports the plan of unifuzz_reindex(): indexes
+** and rows rebuilt, rows per second and estimated time left
+*/
+SQLITE_PRIVATE void reindexStatusFunc(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
+){
+    ReindexPlanT *p = (ReindexPlanT *) sqlite3_user_data(context);
+    sqlite3_int64 nRate, msLeft;
+    char *z;
+    UNUSED_PARAMETER(argc);
+    UNUSED_PARAMETER(argv);
+
+    if (p->zTarget == 0) {
+        sqlite3_result_text(context, "idle", -1, SQLITE_STATIC);
+        return;
+    }
+    nRate = p->msSpent ? (p->nRowDone * 1000 / p->msSpent) : 0;
+    msLeft = nRate ? ((p->nRowTotal - p->nRowDone) * 1000 / nRate) : 0;
+    z = sqlite3_mprintf("target %s, indexes %d / %d, rows %lld / %lld, %lld rows/s, %lld ms left%s%s",
+                        p->zTarget, p->iNext, p->nIndex, p->nRowDone, p->nRowTotal, nRate, msLeft,
+                        (p->iNext < p->nIndex) ? ", next " : "", (p->iNext < p->nIndex) ? p->azIndex[p->iNext] : "");
+    if (z == 0) {
+        sqlite3_result_error_nomem(context);
+        return;
+    }
+    sqlite3_result_text(context, z, -1, sqlite3_free);
+}
 
 /*
-** UTF-16 version of _atou64
-** updates the running pointer p so that it points either to past the end of string
-** or the first character after the numeric prefix
-**
-** This version only allows for digits (as per table above)
+** unifuzz_sidecar(sidecar, table, column) maintains, in the attached schema
+** <sidecar>, the lookup table <table>_<column> keyed by the rowid of the
+** table of main: the value, its fold, unaccent(fold), RMNOCASE key and
+** phonetic code, with an index on each of the last four.  Only the rows
+** whose value changed since the last call are recomputed, all of them when
+** the fingerprint of the collations changed, or the one of the case and
+** accent tables that the fold and unaccented forms come from: the sidecar
+** records both, hashed together.  Returns how many rows were written or
+** deleted.  The tree itself is never written.
 */
+SQLITE_PRIVATE void sidecarFunc(
+    sqlite3_context *context,
+    int argc,
+    sqlite3_value **argv
+){
+    sqlite3 *db = sqlite3_context_db_handle(context);
+    const char *zSidecar = (const char *) sqlite3_value_text(argv[0]);
+    const char *zTable = (const char *) sqlite3_value_text(argv[1]);
+    const char *zColumn = (const char *) sqlite3_value_text(argv[2]);
+    char zHex[17], zRecorded[17] = "", *zTab, *zMeta, *zSql, *zErr = 0;
+    sqlite3_uint64 h;
+    u8 aTables[8];
+    int i, rc, stale, opened = 0, nChanges = 0;
+    UNUSED_PARAMETER(argc);
 
-// function for "work in progress" functions above
+    if ((zSidecar == 0) || (zTable == 0) || (zColumn == 0)) return;
+    if (sqlite3_stricmp(zSidecar, "main") == 0) {
+        sqlite3_result_error(context, "unifuzz_sidecar: the sidecar must be an attached database", -1);
+        return;
+    }
+    zTab = sqlite3_mprintf("%s_%s", zTable, zColumn);
+    zMeta = sqlite3_mprintf("%s.fingerprint", zTab);
+    rc = ((zTab == 0) || (zMeta == 0)) ? SQLITE_NOMEM : fingerprint_read(db, zSidecar, zMeta, zRecorded);
+    for (i = 0; i < 8; i++) {
+        aTables[i] = (u8) (props_tables.fingerprint >> (8 * i));
+    }
+    h = fingerprint_add(collation_fingerprint, aTables, (int) sizeof(aTables));
+    sqlite3_snprintf(sizeof(zHex), zHex, "%016llx", h);
+    stale = (strcmp(zHex, zRecorded) != 0);
 
-// SQLITE_PRIVATE i64 utf16_atou64(
-// 	const u16 **p,
-// 	int len
-// ){
-//     const u16 *q, *pTerm = &(((u16 *) *p)[len / sizeof(u16)]);
-//     i64 value = 0;
-//     u32 uc;
-//     int i, isnumber, lead0, n;
-//     if (len == 0) return 0;
-//     isnumber = 1;  /* read digits, if any */
-//     lead0 = 1;
-//     while (isnumber && (*p < pTerm)) {
-//         q = *p;
-//         READ_UTF16((*p), pTerm, uc);
-//         for (i = 0; i < sizeof(numeric_table) / sizeof(NumericT); i++) {
-//             if (uc < numeric_table[i].lo) {
-//                 isnumber = 0;
-//                 *p = q;  // position back the pointer at the first non-numeric character
-//                 break;
-//             } else if (uc <= numeric_table[i].hi) {
-//                 n = numeric_table[i].digit + (u8) (uc - numeric_table[i].lo);
-//                 if (! ((n == '0') && (lead0))) {
-//                     value = 10 * value + n;     // do not check for overflow
-//                     lead0 = 0;
-//                 }
-//                 break;
-//             }
-//         }
-//     }
-//     return value;
-// }
+    if (rc == SQLITE_OK) {
+        rc = sqlite3_exec(db, "SAVEPOINT unifuzz_sidecar", 0, 0, 0);
+        opened = (rc == SQLITE_OK);
+    }
+    if (rc == SQLITE_OK) {
+        zSql = sqlite3_mprintf("CREATE TABLE IF NOT EXISTS \"%w\".\"%w\"(id INTEGER PRIMARY KEY, value, fold TEXT, unaccented TEXT, key BLOB, phonetic TEXT);"
+                               "CREATE INDEX IF NOT EXISTS \"%w\".\"%w_fold\" ON \"%w\"(fold);"
+                               "CREATE INDEX IF NOT EXISTS \"%w\".\"%w_unaccented\" ON \"%w\"(unaccented);"
+                               "CREATE INDEX IF NOT EXISTS \"%w\".\"%w_key\" ON \"%w\"(key);"
+                               "CREATE INDEX IF NOT EXISTS \"%w\".\"%w_phonetic\" ON \"%w\"(phonetic);"
+                               "CREATE TABLE IF NOT EXISTS \"%w\".unifuzz_meta(name TEXT PRIMARY KEY, value TEXT);",
+                               zSidecar, zTab,
+                               zSidecar, zTab, zTab,
+                               zSidecar, zTab, zTab,
+                               zSidecar, zTab, zTab,
+                               zSidecar, zTab, zTab,
+                               zSidecar);
+        rc = (zSql == 0) ? SQLITE_NOMEM : sqlite3_exec(db, zSql, 0, 0, 0);
+        sqlite3_free(zSql);
+    }
+    if ((rc == SQLITE_OK) && stale) {
+        zSql = sqlite3_mprintf("DELETE FROM \"%w\".\"%w\"", zSidecar, zTab);
+        rc = (zSql == 0) ? SQLITE_NOMEM : sqlite3_exec(db, zSql, 0, 0, 0);
+        sqlite3_free(zSql);
+    }
+    if (rc == SQLITE_OK) {
+        // the stored value is compared as BINARY: a change of case is a change
+        nChanges = sqlite3_total_changes(db);
+        zSql = sqlite3_mprintf("INSERT OR REPLACE INTO \"%w\".\"%w\"(id, value, fold, unaccented, key, phonetic)"
+                               " SELECT s.rowid, s.\"%w\", fold(s.\"%w\"), unaccent(fold(s.\"%w\")), rmnocase_key(s.\"%w\"), phonetic(s.\"%w\")"
+                               " FROM main.\"%w\" AS s LEFT JOIN \"%w\".\"%w\" AS k ON k.id = s.rowid"
+                               " WHERE k.id IS NULL OR k.value IS NOT s.\"%w\" COLLATE BINARY;"
+                               "DELETE FROM \"%w\".\"%w\" WHERE id NOT IN (SELECT rowid FROM main.\"%w\");",
+                               zSidecar, zTab,
+                               zColumn, zColumn, zColumn, zColumn, zColumn,
+                               zTable, zSidecar, zTab,
+                               zColumn,
+                               zSidecar, zTab, zTable);
+        rc = (zSql == 0) ? SQLITE_NOMEM : sqlite3_exec(db, zSql, 0, 0, 0);
+        sqlite3_free(zSql);
+        nChanges = sqlite3_total_changes(db) - nChanges;
+    }
+    if (rc == SQLITE_OK) {
+        zSql = sqlite3_mprintf("INSERT OR REPLACE INTO \"%w\".unifuzz_meta(name, value) VALUES (%Q, %Q);"
+                               "RELEASE unifuzz_sidecar;",
+                               zSidecar, zMeta, zHex);
+        rc = (zSql == 0) ? SQLITE_NOMEM : sqlite3_exec(db, zSql, 0, 0, 0);
+        sqlite3_free(zSql);
+    }
+    if (rc != SQLITE_OK) {
+        zErr = sqlite3_mprintf("%s", sqlite3_errmsg(db));
+        if (opened) {
+            sqlite3_exec(db, "ROLLBACK TO unifuzz_sidecar; RELEASE unifuzz_sidecar;", 0, 0, 0);
+        }
+    }
+    sqlite3_free(zMeta);
+    sqlite3_free(zTab);
+    if (rc == SQLITE_NOMEM) {
+        sqlite3_result_error_nomem(context);
+    } else if (rc != SQLITE_OK) {
+        sqlite3_result_error(context, zErr ? zErr : "unifuzz_sidecar: out of memory", -1);
+    } else {
+        sqlite3_result_int(context, nChanges);
+    }
+    sqlite3_free(zErr);
+}
 
+/*
+** Prefix completion
+**
+** SELECT completion FROM unifuzz_complete(table, column, prefix [, k]) returns
+** the first k (10 by default) values of column in table of main, in RMNOCASE
+** order, whose RMNOCASE primary weights start with those of prefix: case and
+** accents don't matter.  Values equal for RMNOCASE are returned once.
+**
+** Each completion is a single seek "column > previous ORDER BY column LIMIT 1"
+** with the RMNOCASE collation, so an index on the column with RMNOCASE (as
+** NameTable and PlaceTable have) bounds the cost by k, not by the size of the
+** table.  The range starts at prefix, except for the values whose primary
+** weights are exactly those of prefix but which sort before it by their
+** diacritics (combining marks: 'u' U+0301 for the prefix 'u' U+0308).  They
+** are sought backwards first, k of them at most so that the variants of a
+** prefix don't cost more seeks either: when more than k of them sort before
+** prefix, the k nearest to it are returned.
+*/
+typedef struct completeVtab_ {
+    sqlite3_vtab base;
+    sqlite3 *db;
+} CompleteVtabT;
+
+typedef struct completeCursor_ {
+    sqlite3_vtab_cursor base;
+    sqlite3 *db;
+    char **azValue;
+    int nValue;
+    int iValue;
+} CompleteCursorT;
+
+#define COMPLETE_TABLE          1
+#define COMPLETE_COLUMN         2
+#define COMPLETE_PREFIX         3
+#define COMPLETE_K              4
+#define COMPLETE_DEFAULT_K      10
 
 /*
-** This collation performs a numeric sort on text data,
-** where items are expected to have a variable-size numeric
-** prefix optionally followed by a non-numeric part.
-** Here "numeric characters" mean all Unicode codepoints for
-** numerics having 0..9 equivalence.  This doesn't include
-** roman numerals nor exotic or ancient digit representations
-** which don't use the decimal positional system.
-** Only decimal (digits, litterally) positional systems
-** are dealt with (see table above).
-** Whitespaces are allowed only before the numeric part (see table above).
-** Numeric part can have up to one plus or minus sign (see table above).
-** Items not starting by "spaces" then "sign" then "digits" have value 0.
-** No attempt is made to check for 64-bit signed integer overflow.
-**
-** The optional rest of the strings are sorted by the NOCASE collation
-** defined above.  For this we need the strings to be UTF-16LE encoded.
+** Returns the RMNOCASE key of the UTF-16 string z of nByte bytes in *pzKey
+** (to be freed with sqlite3_free) and the length of its primary weights,
+** or -1 when out of memory
 */
+SQLITE_PRIVATE int complete_key(
+    const u16 *z,
+    int nByte,
+    u8 **pzKey
+){
+    u8 *zKey;
+    int n, len, i = 0;
+
+    n = Utf16CharLen(z, nByte);
+    len = collate_sortkey(NOCASE_FLAGS, z, n, 0);
+    zKey = sqlite3_malloc(len);
+    *pzKey = zKey;
+    if (zKey == 0) return -1;
+    collate_sortkey(NOCASE_FLAGS, z, n, zKey);
+    while ((i + 1 < len) && ((zKey[i] | zKey[i + 1]) != 0)) {
+        i += ((zKey[i] & zKey[i + 1]) == 0xFF) ? 4 : 2;
+    }
+    return i;
+}
 
-SQLITE_PRIVATE int numerics_collate(
-    void *encoding,
-    int nKey1,
-    const void *pKey1,
-    int nKey2,
-    const void *pKey2
+SQLITE_PRIVATE int completeConnect(
+    sqlite3 *db,
+    void *pAux,
+    int argc,
+    const char *const *argv,
+    sqlite3_vtab **ppVtab,
+    char **pzErr
 ){
-    i64 n1, n2;
-    const u16 *p1, *p2;
-    if (pKey1 == 0) {
-        n1 = 0;
-    } else {
-        p1 = (u16 *) pKey1;
-        n1 = utf16_atoi64(&p1, nKey1);
+    CompleteVtabT *pVtab;
+    int rc;
+    UNUSED_PARAMETER(pAux);
+    UNUSED_PARAMETER(argc);
+    UNUSED_PARAMETER(argv);
+    UNUSED_PARAMETER(pzErr);
+    rc = sqlite3_declare_vtab(db, "CREATE TABLE x(completion TEXT COLLATE RMNOCASE, tbl HIDDEN, col HIDDEN, prefix HIDDEN, k HIDDEN)");
+    if (rc != SQLITE_OK) return rc;
+    pVtab = sqlite3_malloc(sizeof(*pVtab));
+    if (pVtab == 0) return SQLITE_NOMEM;
+    memset(pVtab, 0, sizeof(*pVtab));
+    pVtab->db = db;
+    *ppVtab = &pVtab->base;
+    return SQLITE_OK;
+}
+
+SQLITE_PRIVATE int completeDisconnect(sqlite3_vtab *pVtab){
+    sqlite3_free(pVtab);
+    return SQLITE_OK;
+}
+
+/*
+** idxNum has bit (1 << column) set for each argument passed, in column order
+*/
+SQLITE_PRIVATE int completeBestIndex(
+    sqlite3_vtab *pVtab,
+    sqlite3_index_info *pInfo
+){
+    int i, iColumn, aArg[COMPLETE_K + 1], nArg = 0;
+    UNUSED_PARAMETER(pVtab);
+    memset(aArg, -1, sizeof(aArg));
+    for (i = 0; i < pInfo->nConstraint; i++) {
+        iColumn = pInfo->aConstraint[i].iColumn;
+        if ((iColumn >= COMPLETE_TABLE) && (pInfo->aConstraint[i].op == SQLITE_INDEX_CONSTRAINT_EQ)) {
+            if (!pInfo->aConstraint[i].usable) return SQLITE_CONSTRAINT;
+            aArg[iColumn] = i;
+        }
     }
-    if (pKey2 == 0) {
-        n2 = 0;
-    } else {
-        p2 = (u16 *) pKey2;
-        n2 = utf16_atoi64(&p2, nKey2);
+    pInfo->idxNum = 0;
+    for (iColumn = COMPLETE_TABLE; iColumn <= COMPLETE_K; iColumn++) {
+        if (aArg[iColumn] >= 0) {
+            pInfo->aConstraintUsage[aArg[iColumn]].argvIndex = ++nArg;
+            pInfo->aConstraintUsage[aArg[iColumn]].omit = 1;
+            pInfo->idxNum |= (1 << iColumn);
+        }
     }
-    if (n1 < n2) {
-        return -1;
-    } else if (n1 == n2) {
-        return(nocase_collate(encoding, (&(((u8 *) pKey1)[nKey1]) - (u8 *) p1), p1, (&(((u8 *) pKey2)[nKey2]) - (u8 *) p2), p2));
-    } else {
-        return 1;
+    pInfo->estimatedCost = 100.0;
+    // the completions come in RMNOCASE order, the collation of the column
+    pInfo->orderByConsumed = ((pInfo->nOrderBy == 1) && (pInfo->aOrderBy[0].iColumn == 0) && !pInfo->aOrderBy[0].desc);
+    return SQLITE_OK;
+}
+
+SQLITE_PRIVATE int completeOpen(
+    sqlite3_vtab *pVtab,
+    sqlite3_vtab_cursor **ppCursor
+){
+    CompleteCursorT *pCur = sqlite3_malloc(sizeof(*pCur));
+    if (pCur == 0) return SQLITE_NOMEM;
+    memset(pCur, 0, sizeof(*pCur));
+    pCur->db = ((CompleteVtabT *) pVtab)->db;
+    *ppCursor = &pCur->base;
+    return SQLITE_OK;
+}
+
+SQLITE_PRIVATE void completeReset(CompleteCursorT *pCur){
+    int i;
+    for (i = 0; i < pCur->nValue; i++) {
+        sqlite3_free(pCur->azValue[i]);
     }
+    sqlite3_free(pCur->azValue);
+    pCur->azValue = 0;
+    pCur->nValue = 0;
+    pCur->iValue = 0;
 }
 
+SQLITE_PRIVATE int completeClose(sqlite3_vtab_cursor *pCursor){
+    completeReset((CompleteCursorT *) pCursor);
+    sqlite3_free(pCursor);
+    return SQLITE_OK;
+}
 
-/* $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$ work in progress!
+/*
+** Steps pStmt, a seek from the value bound to ?1, and tells whether the row
+** found has the primary weights zPrefix of nPrefix bytes as a prefix
+** (exact = 0) or as its whole primary weights (exact = 1).  The value is
+** then copied to *pzValue.
+*/
+SQLITE_PRIVATE int complete_seek(
+    sqlite3_stmt *pStmt,
+    const u8 *zPrefix,
+    int nPrefix,
+    int exact,
+    char **pzValue
+){
+    const u16 *z;
+    u8 *zKey;
+    int rc, nKey;
+
+    *pzValue = 0;
+    rc = sqlite3_step(pStmt);
+    if (rc != SQLITE_ROW) return rc;
+    if (sqlite3_column_type(pStmt, 0) != SQLITE_TEXT) return SQLITE_DONE;
+    z = (const u16 *) sqlite3_column_text16(pStmt, 0);
+    if (z == 0) return SQLITE_NOMEM;
+    nKey = complete_key(z, sqlite3_column_bytes16(pStmt, 0), &zKey);
+    if (nKey < 0) return SQLITE_NOMEM;
+    rc = ((nKey >= nPrefix) && (memcmp(zKey, zPrefix, nPrefix) == 0) && (!exact || (nKey == nPrefix))) ? SQLITE_ROW : SQLITE_DONE;
+    sqlite3_free(zKey);
+    if (rc == SQLITE_ROW) {
+        *pzValue = sqlite3_mprintf("%s", (const char *) sqlite3_column_text(pStmt, 0));
+        if (*pzValue == 0) rc = SQLITE_NOMEM;
+    }
+    return rc;
+}
 
-SQLITE_PRIVATE int readnextdigitEx(
-	const u16 **p,
-	int len
+/*
+** Appends zValue to the completions of pCur, or frees it when out of memory
+*/
+SQLITE_PRIVATE int complete_push(
+    CompleteCursorT *pCur,
+    char *zValue
 ){
-    const u16 *q, *pTerm = &(((u16 *) *p)[len / sizeof(u16)]);
-    u32 uc;
-    int i, n = -1;
-    q = *p;
-    READ_UTF16((*p), pTerm, uc);
-    for (i = 0; i < sizeof(numeric_table) / sizeof(NumericT); i++) {
-        if (uc < numeric_table[i].lo) {
-            *p = q;  // position back the pointer at the first non-numeric character
-            break;
-        } else if (uc <= numeric_table[i].hi) {
-            n = numeric_table[i].digit + (u8) (uc - numeric_table[i].lo);
-            break;
+    char **azNew = sqlite3_realloc(pCur->azValue, (pCur->nValue + 1) * sizeof(char *));
+    if (azNew == 0) {
+        sqlite3_free(zValue);
+        return SQLITE_NOMEM;
+    }
+    pCur->azValue = azNew;
+    pCur->azValue[pCur->nValue++] = zValue;
+    return SQLITE_OK;
+}
+
+SQLITE_PRIVATE int completeFilter(
+    sqlite3_vtab_cursor *pCursor,
+    int idxNum,
+    const char *idxStr,
+    int argc,
+    sqlite3_value **argv
+){
+    CompleteCursorT *pCur = (CompleteCursorT *) pCursor;
+    sqlite3_value *apArg[COMPLETE_K + 1];
+    sqlite3_stmt *apStmt[3] = {0, 0, 0};
+    static const char *azSeek[3] = {"<", ">=", ">"};
+    const char *zTable, *zColumn;
+    sqlite3_stmt *pStmt;
+    char *zSql, *zValue;
+    u8 *zPrefix = 0;
+    int i, j, k, rc = SQLITE_OK, nPrefix;
+    UNUSED_PARAMETER(idxStr);
+    UNUSED_PARAMETER(argc);
+
+    completeReset(pCur);
+    memset(apArg, 0, sizeof(apArg));
+    for (i = COMPLETE_TABLE, j = 0; i <= COMPLETE_K; i++) {
+        if (idxNum & (1 << i)) apArg[i] = argv[j++];
+    }
+    if ((apArg[COMPLETE_TABLE] == 0) || (apArg[COMPLETE_COLUMN] == 0) || (apArg[COMPLETE_PREFIX] == 0)) {
+        sqlite3_free(pCursor->pVtab->zErrMsg);
+        pCursor->pVtab->zErrMsg = sqlite3_mprintf("unifuzz_complete: table, column and prefix are required");
+        return SQLITE_ERROR;
+    }
+    zTable = (const char *) sqlite3_value_text(apArg[COMPLETE_TABLE]);
+    zColumn = (const char *) sqlite3_value_text(apArg[COMPLETE_COLUMN]);
+    k = apArg[COMPLETE_K] ? sqlite3_value_int(apArg[COMPLETE_K]) : COMPLETE_DEFAULT_K;
+    if ((zTable == 0) || (zColumn == 0) || (sqlite3_value_type(apArg[COMPLETE_PREFIX]) == SQLITE_NULL) || (k <= 0)) {
+        return SQLITE_OK;
+    }
+    nPrefix = complete_key((const u16 *) sqlite3_value_text16(apArg[COMPLETE_PREFIX]),
+                           sqlite3_value_bytes16(apArg[COMPLETE_PREFIX]), &zPrefix);
+    if (nPrefix < 0) return SQLITE_NOMEM;
+
+    // 0: backwards from prefix, 1: from prefix, 2: after the previous value
+    for (i = 0; (i < 3) && (rc == SQLITE_OK); i++) {
+        // qualified, an unknown column is an error rather than a string
+        zSql = sqlite3_mprintf("SELECT s.\"%w\" FROM main.\"%w\" AS s WHERE s.\"%w\" COLLATE RMNOCASE %s ?1"
+                               " ORDER BY s.\"%w\" COLLATE RMNOCASE %s LIMIT 1",
+                               zColumn, zTable, zColumn, azSeek[i], zColumn, i ? "ASC" : "DESC");
+        rc = (zSql == 0) ? SQLITE_NOMEM : sqlite3_prepare_v2(pCur->db, zSql, -1, &apStmt[i], 0);
+        sqlite3_free(zSql);
+    }
+    if (rc == SQLITE_OK) {
+        rc = sqlite3_bind_value(apStmt[0], 1, apArg[COMPLETE_PREFIX]);
+    }
+    if (rc == SQLITE_OK) {
+        rc = sqlite3_bind_value(apStmt[1], 1, apArg[COMPLETE_PREFIX]);
+    }
+
+    // values before prefix with its very primary weights, nearest first
+    while ((rc == SQLITE_OK) && (pCur->nValue < k) && ((rc = complete_seek(apStmt[0], zPrefix, nPrefix, 1, &zValue)) == SQLITE_ROW)) {
+        rc = complete_push(pCur, zValue);
+        if (rc == SQLITE_OK) {
+            sqlite3_reset(apStmt[0]);
+            rc = sqlite3_bind_text(apStmt[0], 1, zValue, -1, SQLITE_STATIC);
+        }
+    }
+    for (i = 0, j = pCur->nValue - 1; i < j; i++, j--) {
+        zValue = pCur->azValue[i];
+        pCur->azValue[i] = pCur->azValue[j];
+        pCur->azValue[j] = zValue;
+    }
+    if (rc == SQLITE_DONE) rc = SQLITE_OK;
+
+    // then prefix and the values after it
+    pStmt = apStmt[1];
+    while ((rc == SQLITE_OK) && (pCur->nValue < k) && ((rc = complete_seek(pStmt, zPrefix, nPrefix, 0, &zValue)) == SQLITE_ROW)) {
+        rc = complete_push(pCur, zValue);
+        if (rc == SQLITE_OK) {
+            pStmt = apStmt[2];
+            sqlite3_reset(pStmt);
+            rc = sqlite3_bind_text(pStmt, 1, zValue, -1, SQLITE_STATIC);
         }
     }
-	return(n)
+    if (rc == SQLITE_DONE) rc = SQLITE_OK;
+
+    for (i = 0; i < 3; i++) {
+        sqlite3_finalize(apStmt[i]);
+    }
+    sqlite3_free(zPrefix);
+    if (rc != SQLITE_OK) {
+        if (rc != SQLITE_NOMEM) {
+            sqlite3_free(pCursor->pVtab->zErrMsg);
+            pCursor->pVtab->zErrMsg = sqlite3_mprintf("%s", sqlite3_errmsg(pCur->db));
+        }
+        completeReset(pCur);
+        return rc;
+    }
+    while (pCur->nValue > k) {
+        sqlite3_free(pCur->azValue[--pCur->nValue]);
+    }
+    return SQLITE_OK;
+}
+
+SQLITE_PRIVATE int completeNext(sqlite3_vtab_cursor *pCursor){
+    ((CompleteCursorT *) pCursor)->iValue++;
+    return SQLITE_OK;
 }
 
+SQLITE_PRIVATE int completeEof(sqlite3_vtab_cursor *pCursor){
+    CompleteCursorT *pCur = (CompleteCursorT *) pCursor;
+    return (pCur->iValue >= pCur->nValue);
+}
 
-SQLITE_PRIVATE int naturalsort(
-    void *encoding,
-    int nKey1,
-    const void *pKey1,
-    int nKey2,
-    const void *pKey2
+SQLITE_PRIVATE int completeColumn(
+    sqlite3_vtab_cursor *pCursor,
+    sqlite3_context *context,
+    int i
 ){
-	u16 *s1, *s2;
-    i64 n1, n2;
-	int n;
-	
-	n1 = readnextdigitEx(&pKey1, nKey1);
-	if (n1 >= 0) {		// next chunk of key1 is numeric
-    const u16 *p1, *p2;
-    if (pKey1 == 0) {
-        n1 = 0;
-    } else {
-        p1 = (u16 *) pKey1;
-        n1 = utf16_atou64(&p1, nKey1);
-    }
-    if (pKey2 == 0) {
-        n2 = 0;
-    } else {
-        p2 = (u16 *) pKey2;
-        n2 = utf16_atou64(&p2, nKey2);
+    CompleteCursorT *pCur = (CompleteCursorT *) pCursor;
+    if (i == 0) {
+        sqlite3_result_text(context, pCur->azValue[pCur->iValue], -1, SQLITE_TRANSIENT);
     }
-    if (n1 < n2) {
-        return -1;
-    } else if (n1 == n2) {
-        return(nocase_collate(encoding, (&(((u8 *) pKey1)[nKey1]) - (u8 *) p1), p1, (&(((u8 *) pKey2)[nKey2]) - (u8 *) p2), p2));
-    } else {
-        return 1;
-    }
-
-// u16 *unifuzz_utf16_unacc_utf16(sqlite3_context *context, u16 *inStr, int inBytes, int *outBytes)
-
-	int ret = 0;
-	u16 *z1l, *z1h, *z2l, *z2h;
-	char *szOne, *szTwo;
-	
-
-	szOne = AU3_GetString(&p_AU3_Params[0]);
-	szTwo = AU3_GetString(&p_AU3_Params[1]);
-	CString strFirst = szOne;
-	strFirst.MakeLower();
-	CString strNext = szTwo;
-	strNext.MakeLower();
-
-	// Free temporary storage
-	AU3_FreeString(szOne);
-	AU3_FreeString(szTwo);
-
-	// Allocate and build the return variable
-	pMyResult = AU3_AllocVar();
-
-	// The Alphanum Algorithm is an improved sorting algorithm for strings
-	// containing numbers.  Instead of sorting numbers in ASCII order like
-	// a standard sort, this algorithm sorts numbers in numeric order.
-	//
-	// The Alphanum Algorithm is discussed at http://www.DaveKoelle.com
-	//
-	// This code is a MFC port of the Perl script Alphanum.pl
-
-	static const wchar_t szNumbers[] = L"0123456789";  
-
-	while (n == 0) {        //Get next "chunk"
-		//A chunk is either a group of digit(s) or a group of non-digit(s)
-		CString strFirstChunk;
-		CString strFirstChar( strFirst[0] );
-		if (strFirstChar.FindOneOf( szNumbers ) != -1) {
-			strFirstChunk = strFirst.SpanIncluding(szNumbers);
-		} else {
-			strFirstChunk = strFirst.SpanExcluding(szNumbers);
-		}
+    return SQLITE_OK;
+}
 
-		CString strNextChunk;
-		strFirstChar = strNext[0];
-		if (strFirstChar.FindOneOf( szNumbers ) != -1) {
-			strNextChunk = strNext.SpanIncluding(szNumbers);
-		} else {
-			strNextChunk = strNext.SpanExcluding(szNumbers);
-		}
-		
-		// exit loop if we've run out of chunks, ie strings are equal
-		if (strFirstChunk == "" && strNextChunk == "")
-			break;
-
-		//Remove the extracted chunks from the strings
-		strFirst = strFirst.Mid(strFirstChunk.GetLength(), strFirst.GetLength() - strFirstChunk.GetLength());
-		strNext  = strNext.Mid(strNextChunk.GetLength(), strNext.GetLength() - strNextChunk.GetLength());
-
-		// Now Compare the chunks
-		//# Case 1: They both contain letters
-		if (strFirstChunk.FindOneOf(szNumbers) == -1 && strNextChunk.FindOneOf(szNumbers)  == -1) {
-			n = strFirstChunk.Compare( strNextChunk );
-		} else {
-			//Case 2: They both contain numbers
-			if (strFirstChunk.FindOneOf(szNumbers) != -1 && strNextChunk.FindOneOf(szNumbers) != -1) {
-				//Convert the numeric strings to long values
-				long lFirst = _wtol( strFirstChunk );
-				long lNext = _wtol( strNextChunk );
-
-				n = 0;
-				if ( lFirst > lNext ) {
-					n = 1;
-				} else if ( lFirst < lNext ) {
-					n = -1;
-				}
-			} else {
-				// Case 3: One has letters, one has numbers;
-				// or one is empty
-				n = strFirstChunk.Compare( strNextChunk );
-
-				// If these are equal, make one (which one
-				// is arbitrary) come before
-				// the other   (or else we will be stuck
-				// in this "while n==0" loop)
-				if (n == 0) {
-					n = 1;
-				}
-			}
-		}
-	}
-	return ret;
+SQLITE_PRIVATE int completeRowid(
+    sqlite3_vtab_cursor *pCursor,
+    sqlite3_int64 *pRowid
+){
+    *pRowid = ((CompleteCursorT *) pCursor)->iValue + 1;
+    return SQLITE_OK;
 }
-$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$ */
+
+static sqlite3_module completeModule = {
+    0,                          /* iVersion */
+    0,                          /* xCreate: eponymous only */
+    completeConnect,
+    completeBestIndex,
+    completeDisconnect,
+    0,                          /* xDestroy */
+    completeOpen,
+    completeClose,
+    completeFilter,
+    completeNext,
+    completeEof,
+    completeColumn,
+    completeRowid,
+    0, 0, 0, 0, 0, 0, 0         /* xUpdate ... xRename */
+};
 
 
 #endif	// NO_WINDOWS_COLLATION
@@ -5416,6 +7720,7 @@ int sqlite3_extension_init(
         {"fold",            1,  SQLITE_UTF8,      (void *) unifuzz_fold, caseFunc8       , 0},
         {"flip",            1,  SQLITE_UTF8,                          0, flipFunc8       , 0},
         {"unaccent",        1,  SQLITE_UTF8,                          0, unaccFunc8      , 0},
+        {"phonetic",        1,  SQLITE_UTF8 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS, 0, phoneticFunc8, 0},
         {"proper",          1,  SQLITE_UTF8,                          0, properFunc8     , 0},
         {"typos",           2,  SQLITE_UTF8,                          0, typosFunc8      , 0},
         {"ascw",            1,  SQLITE_UTF8,                          0, ascwFunc8       , 0},
@@ -5449,6 +7754,7 @@ int sqlite3_extension_init(
         {"fold",            1,  SQLITE_UTF16,     (void *) unifuzz_fold, caseFunc16      , 0},
         {"flip",            1,  SQLITE_UTF16,                         0, flipFunc16      , 0},
         {"unaccent",        1,  SQLITE_UTF16,                         0, unaccFunc16     , 0},
+        {"phonetic",        1,  SQLITE_UTF16 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS, 0, phoneticFunc16, 0},
         {"proper",          1,  SQLITE_UTF16,                         0, properFunc16    , 0},
         {"typos",           2,  SQLITE_UTF16,                         0, typosFunc16     , 0},
         {"ascw",            1,  SQLITE_UTF16,                         0, ascwFunc16      , 0},
@@ -5461,12 +7767,58 @@ int sqlite3_extension_init(
         {"strfilter",       2,  SQLITE_UTF16,                         0, strfilterFunc16 , 0},
         {"strtaboo",        2,  SQLITE_UTF16,                         0, strtabooFunc16  , 0},
 #endif
+        {"unifuzz_tables",  0,  SQLITE_UTF8 | SQLITE_DETERMINISTIC,   0, tablesFunc      , 0},
+#ifndef NO_WINDOWS_COLLATION
+        /* sort keys are UTF-16 only: the conversion is paid once per key, not per compare */
+        {"rmnocase_key",    1,  SQLITE_UTF16 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS, (void *) &nocase_key_flags, sortkeyFunc16, 0},
+        {"unaccented_key",  1,  SQLITE_UTF16 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS, (void *) &unaccented_key_flags, sortkeyFunc16, 0},
+        {"names_key",       1,  SQLITE_UTF16 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS, (void *) &names_key_flags, sortkeyFunc16, 0},
+        {"rmnocase_abbrev", 1,  SQLITE_UTF16 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS, 0, abbrevFunc16, 0},
+        {"rmnocase_canon",  1,  SQLITE_UTF16 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS, (void *) &nocase_canon_flags, canonFunc16, 0},
+        {"unaccented_canon", 1, SQLITE_UTF16 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS, (void *) &unaccented_canon_flags, canonFunc16, 0},
+        {"names_canon",     1,  SQLITE_UTF16 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS, (void *) &names_canon_flags, canonFunc16, 0},
+        {"rmnocase_hash",   1,  SQLITE_UTF16 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS, (void *) &nocase_canon_flags, hashFunc16, 0},
+        {"unaccented_hash", 1,  SQLITE_UTF16 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS, (void *) &unaccented_canon_flags, hashFunc16, 0},
+        {"names_hash",      1,  SQLITE_UTF16 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS, (void *) &names_canon_flags, hashFunc16, 0},
+        {"like_lower_bound", 1, SQLITE_UTF16 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS, (void *) &like_bound_lower, likeBoundFunc, 0},
+        {"like_lower_bound", 2, SQLITE_UTF16 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS, (void *) &like_bound_lower, likeBoundFunc, 0},
+        {"like_upper_bound", 1, SQLITE_UTF16 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS, (void *) &like_bound_upper, likeBoundFunc, 0},
+        {"like_upper_bound", 2, SQLITE_UTF16 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS, (void *) &like_bound_upper, likeBoundFunc, 0},
+#ifdef UNIFUZZ_UTF8_COLLATION
+        {"rmnocase_abbrev", 1,  SQLITE_UTF8 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS,  0, abbrevFunc8, 0},
+        {"rmnocase_canon",  1,  SQLITE_UTF8 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS,  (void *) &nocase_canon_flags, canonFunc8, 0},
+        {"unaccented_canon", 1, SQLITE_UTF8 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS,  (void *) &unaccented_canon_flags, canonFunc8, 0},
+        {"names_canon",     1,  SQLITE_UTF8 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS,  (void *) &names_canon_flags, canonFunc8, 0},
+        {"rmnocase_hash",   1,  SQLITE_UTF8 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS,  (void *) &nocase_canon_flags, hashFunc8, 0},
+        {"unaccented_hash", 1,  SQLITE_UTF8 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS,  (void *) &unaccented_canon_flags, hashFunc8, 0},
+        {"names_hash",      1,  SQLITE_UTF8 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS,  (void *) &names_canon_flags, hashFunc8, 0},
+#endif
+        {"unifuzz_fingerprint",    0, SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0, fingerprintFunc, 0},
+        {"unifuzz_needs_reindex",  0, SQLITE_UTF8,                      0, needsReindexFunc, 0},
+        {"unifuzz_needs_reindex",  1, SQLITE_UTF8,                      0, needsReindexFunc, 0},
+        {"unifuzz_needs_reindex",  2, SQLITE_UTF8,                      0, needsReindexFunc, 0},
+        {"unifuzz_mark_reindexed", 0, SQLITE_UTF8 | SQLITE_DIRECTONLY,  0, markReindexedFunc, 0},
+        {"unifuzz_mark_reindexed", 1, SQLITE_UTF8 | SQLITE_DIRECTONLY,  0, markReindexedFunc, 0},
+        {"unifuzz_mark_reindexed", 2, SQLITE_UTF8 | SQLITE_DIRECTONLY,  0, markReindexedFunc, 0},
+        {"unifuzz_reindex_failing", 0, SQLITE_UTF8 | SQLITE_DIRECTONLY, 0, reindexFailingFunc, 0},
+        {"unifuzz_reindex_failing", 1, SQLITE_UTF8 | SQLITE_DIRECTONLY, 0, reindexFailingFunc, 0},
+        {"unifuzz_sidecar",        3, SQLITE_UTF8 | SQLITE_DIRECTONLY,  0, sidecarFunc, 0},
+#endif  // NO_WINDOWS_COLLATION
         {"printf",         -1,  SQLITE_ANY,                           0, printfFunc      , 0},
         {"unifuzz",         0,  SQLITE_ANY,                           0, versionFunc     , 0}
     };
     int i, rc = SQLITE_OK;
+#ifndef NO_WINDOWS_COLLATION
+    KeyCacheT *pCache;
+    ReindexPlanT *pPlan;
+#endif
     SQLITE_EXTENSION_INIT2(pApi)
     UNUSED_PARAMETER(pzErrMsg);
+    props_load();
+#ifndef NO_WINDOWS_COLLATION
+    numclass_build();
+    fingerprint_build();
+#endif
 
     for(i = 0; ((i < (int) ((sizeof(scalars) / sizeof(struct FuncScalar)))) && (rc == SQLITE_OK)); i++){
         struct FuncScalar *p = &scalars[i];
@@ -5477,25 +7829,87 @@ int sqlite3_extension_init(
     }
 
 #ifndef NO_WINDOWS_COLLATION
+    if (rc == SQLITE_OK)
+        rc = sqlite3_create_module(db, "unifuzz_check_indexes", &checkIndexesModule, 0);
+    if (rc == SQLITE_OK)
+        rc = sqlite3_create_module(db, "unifuzz_complete", &completeModule, 0);
+    if (rc == SQLITE_OK)
+        rc = sqlite3_create_module(db, "like_ranges", &likeRangesModule, 0);
+
+    /* the key cache of this connection, freed with the last function or collation using it */
+    pCache = sqlite3_malloc(sizeof(KeyCacheT));
+    if (pCache == 0) {
+        return SQLITE_NOMEM;
+    }
+    memset(pCache, 0, sizeof(KeyCacheT));
+    pCache->nRef = 1;           /* ours, until the registrations are done */
+    for (i = 0; (i <= 2) && (rc == SQLITE_OK); i++) {
+        pCache->nRef++;         /* xDestroy is called even when the registration fails */
+        rc = sqlite3_create_function_v2(db, "unifuzz_keycache", i, SQLITE_UTF8, pCache, keycacheFunc, 0, 0, keycache_release);
+    }
+
     /* Also override the default NOCASE case-insensitive collation sequence. */
     // Warning: encoding UTF-16LE is mandatory
 #ifdef UNIFUZZ_OVERRIDE_NOCASE
     if (rc == SQLITE_OK)
-        rc = sqlite3_create_collation(db, "NOCASE",    SQLITE_UTF16LE, 0, nocase_collate);
+        rc = keycache_create_collation(db, "NOCASE",    SQLITE_UTF16LE, pCache, nocase_collate);
 
     if (rc == SQLITE_OK)
-        rc = sqlite3_create_collation(db, "RMNOCASE",  SQLITE_UTF16LE, 0, nocase_collate);	// special for Tom Holden!
+        rc = keycache_create_collation(db, "RMNOCASE",  SQLITE_UTF16LE, pCache, nocase_collate);	// special for Tom Holden!
 #else
     if (rc == SQLITE_OK)
-        rc = sqlite3_create_collation(db, "NOCASEU",   SQLITE_UTF16LE, 0, nocase_collate);
+        rc = keycache_create_collation(db, "NOCASEU",   SQLITE_UTF16LE, pCache, nocase_collate);
 #endif
 
     if ((rc == SQLITE_OK) || (rc == SQLITE_BUSY))
-        rc = sqlite3_create_collation(db, "NAMES",     SQLITE_UTF16LE, 0, names_collate);
+        rc = keycache_create_collation(db, "NAMES",     SQLITE_UTF16LE, pCache, names_collate);
     if (rc == SQLITE_OK)
-        rc = sqlite3_create_collation(db, "UNACCENTED",SQLITE_UTF16LE, 0, unaccented_collate);
+        rc = keycache_create_collation(db, "UNACCENTED",SQLITE_UTF16LE, pCache, unaccented_collate);
     if (rc == SQLITE_OK)
         rc = sqlite3_create_collation(db, "NUMERICS",  SQLITE_UTF16LE, 0, numerics_collate);
+    if (rc == SQLITE_OK)
+        rc = sqlite3_create_collation(db, "NATURAL",   SQLITE_UTF16LE, 0, natural_collate);
+
+#ifdef UNIFUZZ_UTF8_COLLATION
+    /* Same collations for UTF-8 bases, without conversion of the keys to UTF-16 */
+#ifdef UNIFUZZ_OVERRIDE_NOCASE
+    if (rc == SQLITE_OK) {
+        rc = keycache_create_collation(db, "NOCASE",    SQLITE_UTF8,    pCache, nocase_collate8);
+        if (rc == SQLITE_BUSY)      // the built-in UTF-8 NOCASE can't be overriden when loading from SQL
+            rc = SQLITE_OK;
+    }
+    if (rc == SQLITE_OK)
+        rc = keycache_create_collation(db, "RMNOCASE",  SQLITE_UTF8,    pCache, nocase_collate8);
+#else
+    if (rc == SQLITE_OK)
+        rc = keycache_create_collation(db, "NOCASEU",   SQLITE_UTF8,    pCache, nocase_collate8);
+#endif
+    if (rc == SQLITE_OK)
+        rc = keycache_create_collation(db, "NAMES",     SQLITE_UTF8,    pCache, names_collate8);
+    if (rc == SQLITE_OK)
+        rc = keycache_create_collation(db, "UNACCENTED",SQLITE_UTF8,    pCache, unaccented_collate8);
+    if (rc == SQLITE_OK)
+        rc = sqlite3_create_collation(db, "NUMERICS",  SQLITE_UTF8,    0, numerics_collate8);
+    if (rc == SQLITE_OK)
+        rc = sqlite3_create_collation(db, "NATURAL",   SQLITE_UTF8,    0, natural_collate8);
+#endif  // UNIFUZZ_UTF8_COLLATION
+    keycache_release(pCache);
+
+    /* the unifuzz_reindex() plan of this connection, likewise */
+    pPlan = sqlite3_malloc(sizeof(ReindexPlanT));
+    if (pPlan == 0) {
+        return SQLITE_NOMEM;
+    }
+    memset(pPlan, 0, sizeof(ReindexPlanT));
+    pPlan->nRef = 1;
+    for (i = 0; (i <= 2) && (rc == SQLITE_OK); i++) {
+        pPlan->nRef++;
+        if (i == 0)
+            rc = sqlite3_create_function_v2(db, "unifuzz_reindex_status", 0, SQLITE_UTF8, pPlan, reindexStatusFunc, 0, 0, reindex_plan_release);
+        else
+            rc = sqlite3_create_function_v2(db, "unifuzz_reindex", i, SQLITE_UTF8 | SQLITE_DIRECTONLY, pPlan, reindexFunc, 0, 0, reindex_plan_release);
+    }
+    reindex_plan_release(pPlan);
 #endif		// NO_WINDOWS_COLLATION
 
 assert(rc == 0);